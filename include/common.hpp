@@ -1,9 +1,11 @@
 #pragma once
 #include <iostream>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -11,6 +13,10 @@
 #define MB (1048576ULL)
 #define GB (1073741824ULL)
 
+// Bytes read to decode a Thrift page or Bloom filter header whose size is
+// not known up front. Headers are far smaller unless they carry statistics.
+inline constexpr size_t HEADER_READ_SIZE = 256;
+
 // ── Parquet Enums ──────────────────────────────────────────────────────────────
 
 enum class ParquetType : int32_t {
@@ -61,6 +67,12 @@ enum class FieldRepetitionType : int32_t {
     REPEATED = 2
 };
 
+enum class BoundaryOrder : int32_t {
+    UNORDERED = 0,
+    ASCENDING = 1,
+    DESCENDING = 2
+};
+
 enum class ConvertedType : int32_t {
     NONE = -1,
     UTF8 = 0,
@@ -174,9 +186,12 @@ private:
 
 // ── Value type for column data ─────────────────────────────────────────────────
 
+// BYTE_ARRAY values are either an owned std::string or, when decoded into a
+// StringArena, a std::string_view that stays valid until the arena is reset.
+// Use str() to read either form.
 struct Value {
     bool is_null = true;
-    std::variant<bool, int32_t, int64_t, float, double, std::string> data;
+    std::variant<bool, int32_t, int64_t, float, double, std::string, std::string_view> data;
 
     static Value null() { return Value{true, {}}; }
     static Value from_bool(bool v) { return Value{false, v}; }
@@ -185,6 +200,12 @@ struct Value {
     static Value from_float(float v) { return Value{false, v}; }
     static Value from_double(double v) { return Value{false, v}; }
     static Value from_string(std::string v) { return Value{false, std::move(v)}; }
+    static Value from_view(std::string_view v) { return Value{false, v}; }
+
+    std::string_view str() const {
+        if (auto* s = std::get_if<std::string>(&data)) return *s;
+        return std::get<std::string_view>(data);
+    }
 
     std::string to_string() const {
         if (is_null) return "NULL";
@@ -192,14 +213,37 @@ struct Value {
             using T = std::decay_t<decltype(arg)>;
             if constexpr (std::is_same_v<T, bool>)
                 return arg ? "true" : "false";
-            else if constexpr (std::is_same_v<T, std::string>)
-                return arg;
+            else if constexpr (std::is_same_v<T, std::string> ||
+                               std::is_same_v<T, std::string_view>)
+                return std::string(arg);
             else
                 return std::to_string(arg);
         }, data);
     }
 };
 
+// ── ByteArrayBuffer ────────────────────────────────────────────────────────────
+
+// Offsets + contiguous data layout for decoded BYTE_ARRAY values.
+// Value i occupies data[offsets[i], offsets[i + 1]).
+struct ByteArrayBuffer {
+    std::vector<uint32_t> offsets{0};
+    std::vector<char> data;
+
+    size_t size() const { return offsets.size() - 1; }
+    bool empty() const { return offsets.size() == 1; }
+    void clear() { offsets.assign(1, 0); data.clear(); }
+
+    const char* ptr(size_t i) const { return data.data() + offsets[i]; }
+    size_t length(size_t i) const { return offsets[i + 1] - offsets[i]; }
+    std::string_view view(size_t i) const { return {ptr(i), length(i)}; }
+
+    void append(const char* p, size_t n) {
+        data.insert(data.end(), p, p + n);
+        offsets.push_back(static_cast<uint32_t>(data.size()));
+    }
+};
+
 // ── Parquet type name helper ───────────────────────────────────────────────────
 
 inline const char* parquet_type_name(ParquetType t) {
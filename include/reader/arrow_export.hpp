@@ -0,0 +1,73 @@
+#pragma once
+#include "column_info.hpp"
+#include "column_vector.hpp"
+#include "record_batch_reader.hpp"
+#include <cstdint>
+
+// ── Arrow C Data Interface ─────────────────────────────────────────────────────
+//
+// The ABI structs of https://arrow.apache.org/docs/format/CDataInterface.html,
+// declared here so exporting needs no Arrow dependency. The guard matches
+// Arrow's own abi.h, so both headers can be included together.
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C" {
+
+struct ArrowSchema {
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+    void (*release)(struct ArrowSchema*);
+    void* private_data;
+};
+
+struct ArrowArray {
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+    void (*release)(struct ArrowArray*);
+    void* private_data;
+};
+
+} // extern "C"
+
+#endif // ARROW_C_DATA_INTERFACE
+
+// ── Export ─────────────────────────────────────────────────────────────────────
+//
+// Arrays take ownership of the vector's buffers: validity, fixed-width data
+// and string offsets/data are handed to the consumer as they are and freed
+// by the release callback. The vector is left empty (size 0, no buffers)
+// but keeps its type, so a schema can still be exported from it. Only
+// BOOLEAN (bytes packed to bits) and DECIMAL64 (widened to Arrow's 128-bit
+// decimal) are converted on the way out.
+//
+// Type mapping: BOOLEAN "b", INT32 "i", INT64 "l", FLOAT "f", DOUBLE "g",
+// BYTE_ARRAY "u" for UTF8 / ENUM / JSON columns and "z" otherwise,
+// FIXED_BYTES "w:N", DECIMAL64 / DECIMAL128 "d:P,S", TIMESTAMP_NS "tsn:".
+// String columns must stay under 2 GiB per array (32-bit offsets).
+
+void export_arrow_array(ColumnVector&& vec, ArrowArray* out);
+
+// Schema for arrays exported from vectors of `vec`'s type. `info` supplies
+// the field name, nullability and the string logical type.
+void export_arrow_schema(const ColumnVector& vec, const ColumnInfo& info, ArrowSchema* out);
+
+// A batch exports as a struct array ("+s") with one child per column.
+void export_arrow_array(RecordBatch&& batch, ArrowArray* out);
+void export_arrow_schema(const RecordBatch& batch, ArrowSchema* out);
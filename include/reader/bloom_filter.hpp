@@ -0,0 +1,43 @@
+#pragma once
+#include "column_info.hpp"
+#include "common.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+// ── xxHash64 ───────────────────────────────────────────────────────────────────
+
+// XXH64 of `size` bytes, the hash Parquet Bloom filters are keyed with.
+uint64_t xxhash64(const uint8_t* data, size_t size, uint64_t seed = 0);
+
+// ── BloomFilter ────────────────────────────────────────────────────────────────
+//
+// Parquet split-block Bloom filter: 32-byte blocks of eight 32-bit words.
+// The upper half of a value's hash picks the block and the lower half sets
+// one bit in each word. A probe is checked against all eight words at once
+// with AVX2 when the CPU has it (chosen once at runtime).
+
+class BloomFilter {
+public:
+    static constexpr size_t BYTES_PER_BLOCK = 32;
+
+    // `bitset` must be a whole number of blocks.
+    explicit BloomFilter(std::vector<uint8_t> bitset);
+
+    // Hash of `value` as stored in the filter of column `col`: XXH64 of its
+    // PLAIN encoding (raw bytes for byte arrays). nullopt for values the
+    // filter cannot answer for: BOOLEAN and INT96 columns, DECIMAL byte
+    // arrays, and literals not exactly representable in the column's type.
+    static std::optional<uint64_t> hash(const Value& value, const ColumnInfo& col);
+
+    // False only if no value with this hash was inserted.
+    bool might_contain_hash(uint64_t hash) const;
+    bool might_contain(const Value& value, const ColumnInfo& col) const;
+
+    size_t num_bytes() const { return bitset_.size(); }
+
+private:
+    std::vector<uint8_t> bitset_;
+    size_t num_blocks_;
+};
@@ -0,0 +1,20 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// ── BYTE_STREAM_SPLIT ──────────────────────────────────────────────────────────
+//
+// A page of N values of K bytes is stored as K streams of N bytes: byte k of
+// value i lives at data[k * N + i]. Decoding interleaves the streams back.
+//
+// `src` points at byte 0 of the first value to decode, `stride` is the stream
+// length N of the page, and `count` values of `width` bytes are written to
+// `out`. Widths 4 and 8 use SSE2/AVX2 shuffle kernels when available (chosen
+// once at runtime); every other width uses the scalar loop.
+
+void byte_stream_split_decode(const uint8_t* src, size_t stride, size_t width,
+                              size_t count, uint8_t* out);
+
+// Portable reference implementation, also used for tails and odd widths.
+void byte_stream_split_decode_scalar(const uint8_t* src, size_t stride, size_t width,
+                                     size_t count, uint8_t* out);
@@ -2,19 +2,28 @@
 #include "common.hpp"
 #include <optional>
 #include <string>
+#include <vector>
 
 struct ColumnInfo {
     std::string name;
+    std::string path;    // dotted path from the schema root, e.g. "tags.list.element"
     ParquetType type;
     int column_index;    // index into row_group.columns
     int16_t max_def_level;
     int16_t max_rep_level;
     std::optional<FieldRepetitionType> repetition;
     std::optional<ConvertedType> converted_type;
+    std::optional<int32_t> type_length;  // FIXED_LEN_BYTE_ARRAY only
+    std::optional<int32_t> scale;        // DECIMAL only
+    std::optional<int32_t> precision;    // DECIMAL only
+    // Definition level of each REPEATED node on the path, outermost first
+    // (max_rep_level entries). Used to assemble list offsets.
+    std::vector<int16_t> repeated_def_levels;
 
     std::string type_name() const;
     std::string converted_type_string() const;
     bool is_required() const;
     bool is_optional() const;
     bool is_repeated() const;
+    bool is_decimal() const;
 };
@@ -1,14 +1,40 @@
 #pragma once
+#include "byte_stream_split.hpp"
+#include "column_info.hpp"
+#include "column_vector.hpp"
+#include "compression.hpp"
+#include "crc32.hpp"
+#include "decimal.hpp"
+#include "decode_kernels.hpp"
+#include "delta_decoder.hpp"
+#include "dictionary_cache.hpp"
+#include "dictionary_gather.hpp"
+#include "int96.hpp"
 #include "metadata.hpp"
+#include "page_header_cache.hpp"
 #include "rle_decoder.hpp"
+#include "string_arena.hpp"
 #include <algorithm>
 #include <cstring>
 #include <functional>
+#include <iterator>
 #include <vector>
 
 // Callback type: read_range(offset, length) -> bytes
 using ReadRangeFunc = std::function<std::vector<uint8_t>(size_t, size_t)>;
 
+// Per-page buffers a ColumnReader decodes through. Each reader has its
+// own; a longer-lived owner can lend one with set_scratch() so that short-
+// lived readers (one per row group or batch) keep the capacity from call to
+// call. A scratch must not be lent to two readers decoding concurrently.
+struct DecodeScratch {
+    std::vector<uint8_t> page_stored;
+    std::vector<uint8_t> decompressed;
+    std::vector<int16_t> def_levels;
+    std::vector<int16_t> rep_levels;
+    std::vector<uint32_t> indices;
+};
+
 struct PageResult {
     int page_num;
     PageType type;
@@ -21,22 +47,138 @@ public:
     ColumnReader(ReadRangeFunc read_range,
                  const ColumnChunk& chunk, ParquetType type,
                  int16_t max_def_level, int16_t max_rep_level);
+    ColumnReader(ReadRangeFunc read_range,
+                 const ColumnChunk& chunk, const ColumnInfo& info);
 
     std::vector<Value> read_all();
     std::vector<PageResult> read_pages();
 
+    // Decode into caller-owned buffers so their capacity is reused across
+    // calls. read_all() appends to `out`; read_pages() overwrites `pages`,
+    // reusing existing entries' value vectors. Both return the number of
+    // values written.
+    size_t read_all(std::vector<Value>& out);
+    size_t read_pages(std::vector<PageResult>& pages);
+
+    // Decode only the data page whose header starts at file offset
+    // `page_offset`, appending its values to `out`. The chunk's dictionary
+    // page is read first when it has one; no other page is. Returns the
+    // number of values appended.
+    size_t read_page_at(size_t page_offset, std::vector<Value>& out);
+
+    // Typed, columnar decode of the whole chunk, appended to `out`. An empty
+    // `out` is (re)initialized for this column's vector_type(). Returns the
+    // number of slots appended.
+    size_t read_all(ColumnVector& out);
+    VectorType vector_type() const;
+
+    // Assemble a repeated column into list offsets plus leaf values,
+    // appended to `out`. Requires the ColumnInfo constructor. Returns the
+    // number of records appended.
+    size_t read_all(ListVector& out);
+
+    // Page-at-a-time typed decode of a non-repeated column: append the next
+    // data page to `out` (initialized as by read_all) and return the number
+    // of slots appended, 0 once the chunk is exhausted. next_page_offset()
+    // is the file offset the following call reads from; rewind() restarts
+    // at the first page.
+    size_t read_next_page(ColumnVector& out);
+    bool has_next_page() const { return page_values_read_ < meta_->num_values; }
+    size_t next_page_offset() const { return page_offset_; }
+    void rewind();
+
+    // INT96 values decode to nanoseconds since the epoch (Value::from_i64).
+    // Enable to get the legacy "INT96(high:low)" strings instead.
+    void set_int96_as_string(bool enabled) { int96_as_string_ = enabled; }
+
+    // Decode BYTE_ARRAY / FIXED_LEN_BYTE_ARRAY values of the Value API into
+    // `arena` as string_views instead of one std::string each. The values
+    // are valid until the arena is reset. Pass nullptr to go back to owned
+    // strings.
+    void set_string_arena(StringArena* arena) { string_arena_ = arena; }
+
+    // Share decoded dictionary pages through `cache` under `key` instead of
+    // decoding them on every call. A cached dictionary page is not re-read.
+    void set_dictionary_cache(DictionaryCache* cache, DictionaryCache::Key key) {
+        dict_cache_ = cache;
+        dict_key_ = std::move(key);
+    }
+
+    // Take the chunk's page headers from `cache` under `key` when another
+    // walk recorded them, and record them there after this reader's first
+    // walk. Without a cache they are still kept for the reader's own scans.
+    void set_page_header_cache(PageHeaderCache* cache, PageHeaderCache::Key key) {
+        header_cache_ = cache;
+        header_key_ = key;
+        headers_.reset();
+    }
+
+    // Decode through `scratch` instead of the reader's own buffers;
+    // nullptr goes back to them.
+    void set_scratch(DecodeScratch* scratch) { lent_scratch_ = scratch; }
+
+    // Check each page read against the CRC in its header and count the
+    // result in `checksums`; nullptr (the default) skips the check.
+    void set_page_checksums(PageChecksums* checksums) { checksums_ = checksums; }
+
 private:
     std::vector<Value> read_dictionary_page(const uint8_t* data, int32_t size,
                                             const DictionaryPageHeader& header);
-    std::vector<Value> read_data_page(const uint8_t* data, int32_t size,
-                                      const DataPageHeader& header,
-                                      const std::vector<Value>* dictionary);
-    Value read_plain_value(ByteBuffer& buf);
+    void read_data_page(const uint8_t* data, int32_t size, const DataPageHeader& header,
+                        const std::vector<Value>* dictionary, std::vector<Value>& out);
+    Value read_plain_value(ByteBuffer& buf, StringArena* arena);
+    static Value make_string(std::string_view s, StringArena* arena);
+    DictionaryCache::Values load_dictionary(size_t offset, const PageHeader& header);
+    DictionaryCache::Vector load_dictionary_vector(size_t offset, const PageHeader& header);
+    PageSpan read_page_payload(size_t offset, const PageHeader& header);
+    size_t first_page_offset() const;
+    const std::vector<CachedPageHeader>& page_headers();
     static uint8_t bit_width(int16_t max_level);
 
+    // Typed decode helpers
+    void init_vector(ColumnVector& out) const;
+    size_t physical_width() const;
+    void read_dictionary_page(const uint8_t* data, int32_t size,
+                              const DictionaryPageHeader& header, ColumnVector& dict);
+    void read_chunk(ColumnVector& out, ListVector* lists);
+    bool decode_next_page(ColumnVector& out, ListVector* lists);
+    void read_data_page(const uint8_t* data, int32_t size, const DataPageHeader& header,
+                        const ColumnVector* dictionary, ColumnVector& out,
+                        ListVector* lists = nullptr);
+    void assemble_lists(const int16_t* def_levels, const int16_t* rep_levels,
+                        size_t count, ListVector& lists) const;
+    void decode_values(ByteBuffer& buf, Encoding encoding, const ColumnVector* dictionary,
+                       size_t count, ColumnVector& out, size_t base);
+    void decode_fixed(const uint8_t* raw, size_t count, uint8_t* dst) const;
+
     ReadRangeFunc read_range_;
     const ColumnMetaData* meta_;
     ParquetType type_;
     int16_t max_def_level_;
     int16_t max_rep_level_;
+    std::vector<int16_t> repeated_def_levels_;
+    int32_t type_length_ = 0;
+    bool is_decimal_ = false;
+    int32_t scale_ = 0;
+    int32_t precision_ = 0;
+    bool int96_as_string_ = false;
+    StringArena* string_arena_ = nullptr;
+    DictionaryCache* dict_cache_ = nullptr;
+    DictionaryCache::Key dict_key_;
+    PageChecksums* checksums_ = nullptr;
+    PageHeaderCache* header_cache_ = nullptr;
+    PageHeaderCache::Key header_key_;
+    PageHeaderCache::Headers headers_;
+
+    // Page cursor of the typed decode path
+    size_t page_offset_ = 0;
+    size_t page_cursor_ = 0;  // index into page_headers()
+    int64_t page_values_read_ = 0;
+    DictionaryCache::Vector page_dictionary_;
+
+    // Per-page scratch, reused across pages and calls
+    DecodeScratch& scratch() { return lent_scratch_ ? *lent_scratch_ : own_scratch_; }
+    PageDecompressor decompressor_;
+    DecodeScratch own_scratch_;
+    DecodeScratch* lent_scratch_ = nullptr;
 };
@@ -0,0 +1,157 @@
+#pragma once
+#include "common.hpp"
+#include <string_view>
+#include <vector>
+
+// ── VectorType ─────────────────────────────────────────────────────────────────
+
+// Element type of a ColumnVector. Derived from the physical type plus the
+// converted type annotation (e.g. DECIMAL-annotated columns decode to
+// unscaled integers).
+enum class VectorType : int32_t {
+    BOOLEAN,      // uint8_t, 0 or 1
+    INT32,        // int32_t
+    INT64,        // int64_t
+    FLOAT,        // float
+    DOUBLE,       // double
+    BYTE_ARRAY,   // offsets + data in `strings`
+    FIXED_BYTES,  // `value_width` raw bytes per slot (FIXED_LEN_BYTE_ARRAY)
+    DECIMAL64,    // unscaled int64_t
+    DECIMAL128,   // unscaled __int128
+    TIMESTAMP_NS  // int64_t nanoseconds since the Unix epoch (INT96)
+};
+
+inline const char* vector_type_name(VectorType t) {
+    switch (t) {
+        case VectorType::BOOLEAN:      return "BOOLEAN";
+        case VectorType::INT32:        return "INT32";
+        case VectorType::INT64:        return "INT64";
+        case VectorType::FLOAT:        return "FLOAT";
+        case VectorType::DOUBLE:       return "DOUBLE";
+        case VectorType::BYTE_ARRAY:   return "BYTE_ARRAY";
+        case VectorType::FIXED_BYTES:  return "FIXED_BYTES";
+        case VectorType::DECIMAL64:    return "DECIMAL64";
+        case VectorType::DECIMAL128:   return "DECIMAL128";
+        case VectorType::TIMESTAMP_NS: return "TIMESTAMP_NS";
+        default:                       return "UNKNOWN";
+    }
+}
+
+// ── ColumnVector ───────────────────────────────────────────────────────────────
+
+// Typed, columnar decode result with one slot per value, nulls included.
+// Fixed-width values are stored densely in `data` (`value_width` bytes per
+// slot); BYTE_ARRAY values live in `strings`, one entry per slot. Null slots
+// are zeroed (empty for strings) and cleared in the `validity` bitmap, which
+// uses Arrow's LSB bit order and is left empty for REQUIRED columns.
+struct ColumnVector {
+    VectorType type = VectorType::INT32;
+    size_t value_width = 0;
+    size_t size = 0;
+    size_t null_count = 0;
+    int32_t scale = 0;       // DECIMAL64 / DECIMAL128 only
+    int32_t precision = 0;
+
+    std::vector<uint8_t> validity;
+    std::vector<uint8_t> data;
+    ByteArrayBuffer strings;
+
+    template <typename T>
+    const T* values() const { return reinterpret_cast<const T*>(data.data()); }
+    template <typename T>
+    T* values() { return reinterpret_cast<T*>(data.data()); }
+
+    const uint8_t* fixed(size_t i) const { return data.data() + i * value_width; }
+    std::string_view string(size_t i) const { return strings.view(i); }
+
+    bool is_null(size_t i) const {
+        return !validity.empty() && !(validity[i / 8] & (1u << (i % 8)));
+    }
+
+    // Drop all values but keep allocated capacity for reuse.
+    void clear() {
+        size = 0;
+        null_count = 0;
+        validity.clear();
+        data.clear();
+        strings.clear();
+    }
+};
+
+// Append slots [offset, offset + count) of `src` to `dst`. An empty `dst`
+// takes on the element type of `src`.
+inline void append_range(ColumnVector& dst, const ColumnVector& src, size_t offset, size_t count) {
+    if (dst.size == 0) {
+        dst.type = src.type;
+        dst.value_width = src.value_width;
+        dst.scale = src.scale;
+        dst.precision = src.precision;
+    }
+    size_t base = dst.size;
+    if (src.type == VectorType::BYTE_ARRAY) {
+        const auto& so = src.strings.offsets;
+        uint32_t begin = so[offset];
+        uint32_t shift = static_cast<uint32_t>(dst.strings.data.size()) - begin;
+        dst.strings.data.insert(dst.strings.data.end(), src.strings.data.begin() + begin,
+                                src.strings.data.begin() + so[offset + count]);
+        for (size_t i = 1; i <= count; i++) dst.strings.offsets.push_back(so[offset + i] + shift);
+    } else {
+        size_t w = src.value_width;
+        dst.data.insert(dst.data.end(), src.data.begin() + offset * w,
+                        src.data.begin() + (offset + count) * w);
+    }
+    if (!src.validity.empty()) {
+        dst.validity.resize((base + count + 7) / 8, 0);
+        for (size_t i = 0; i < count; i++) {
+            if (src.is_null(offset + i)) {
+                dst.null_count++;
+            } else {
+                size_t bit = base + i;
+                dst.validity[bit / 8] |= static_cast<uint8_t>(1u << (bit % 8));
+            }
+        }
+    }
+    dst.size = base + count;
+}
+
+// ── ListVector ─────────────────────────────────────────────────────────────────
+
+// One nesting level of a repeated column: entry i spans
+// [offsets[i], offsets[i + 1]) of the next level down (or of the leaf
+// values for the innermost level). A null list and an empty list both span
+// zero entries; they are told apart by `validity`, which is left empty when
+// the level cannot be null.
+struct ListLevel {
+    std::vector<int32_t> offsets{0};
+    std::vector<uint8_t> validity;
+    size_t size = 0;
+    size_t null_count = 0;
+    bool nullable = false;
+
+    bool is_null(size_t i) const {
+        return !validity.empty() && !(validity[i / 8] & (1u << (i % 8)));
+    }
+    size_t length(size_t i) const { return static_cast<size_t>(offsets[i + 1] - offsets[i]); }
+
+    void clear() {
+        offsets.assign(1, 0);
+        validity.clear();
+        size = 0;
+        null_count = 0;
+    }
+};
+
+// Arrow-style assembly of a repeated leaf: `levels[0]` has one entry per
+// record, each further level one entry per element of its parent, and
+// `values` one slot per element of the innermost list.
+struct ListVector {
+    std::vector<ListLevel> levels;
+    ColumnVector values;
+
+    size_t size() const { return levels.empty() ? values.size : levels[0].size; }
+
+    void clear() {
+        for (auto& level : levels) level.clear();
+        values.clear();
+    }
+};
@@ -0,0 +1,60 @@
+#pragma once
+#include "common.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ── Codec registry ─────────────────────────────────────────────────────────────
+//
+// Page decompression keyed by CompressionCodec. SNAPPY and LZ4_RAW are
+// built in; GZIP and ZSTD are available when the build found zlib / libzstd
+// (PARQUET_HAVE_ZLIB / PARQUET_HAVE_ZSTD). Other codecs can be plugged in
+// with register_decompressor().
+
+// Decompress `src` into exactly `dst_size` bytes at `dst`. Throws
+// std::runtime_error on corrupt input or a size mismatch.
+using DecompressFunc = void (*)(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size);
+
+// Implementation registered for `codec`, or nullptr when this build has
+// none. UNCOMPRESSED has no implementation; check for it first.
+DecompressFunc find_decompressor(CompressionCodec codec);
+
+// Install or replace the implementation for `codec`. Safe to call while
+// other threads are reading.
+void register_decompressor(CompressionCodec codec, DecompressFunc func);
+
+bool codec_supported(CompressionCodec codec);
+
+// Built-in implementations, usable directly
+void snappy_decompress(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size);
+void lz4_raw_decompress(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size);
+
+// ── PageDecompressor ───────────────────────────────────────────────────────────
+
+// Uncompressed bytes of one page payload.
+struct PageSpan {
+    const uint8_t* data;
+    size_t size;
+};
+
+// Decompresses the pages of one column chunk into a caller-owned buffer
+// that is reused from page to page, growing to the largest
+// uncompressed_page_size seen.
+class PageDecompressor {
+public:
+    // Throws std::runtime_error when `codec` is not supported by this build.
+    explicit PageDecompressor(CompressionCodec codec = CompressionCodec::UNCOMPRESSED);
+
+    CompressionCodec codec() const { return codec_; }
+
+    // Payload of a page stored as `stored` (compressed_page_size bytes) that
+    // decompresses to `uncompressed_size` bytes. For UNCOMPRESSED chunks this
+    // is `stored` itself; otherwise it points into `buffer` and is valid
+    // until the buffer is next written.
+    PageSpan decompress(const uint8_t* stored, size_t stored_size, size_t uncompressed_size,
+                        std::vector<uint8_t>& buffer) const;
+
+private:
+    CompressionCodec codec_;
+    DecompressFunc func_ = nullptr;
+};
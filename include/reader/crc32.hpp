@@ -0,0 +1,39 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+// ── CRC32 ──────────────────────────────────────────────────────────────────────
+//
+// CRC-32 (IEEE, reflected polynomial 0xEDB88320), the checksum Parquet stores
+// in PageHeader::crc and the one zlib's crc32() computes. Large inputs are
+// folded with carry-less multiplies (PCLMULQDQ) when the CPU has them,
+// chosen once at runtime; otherwise and for short tails slicing-by-8 is
+// used, which processes eight bytes per table round.
+
+// Continue a running CRC: crc32(b, n2, crc32(a, n1)) == crc32(a ++ b).
+uint32_t crc32(const uint8_t* data, size_t size, uint32_t crc = 0);
+
+// Portable slicing-by-8 implementation.
+uint32_t crc32_slicing8(const uint8_t* data, size_t size, uint32_t crc = 0);
+
+// ── PageChecksums ──────────────────────────────────────────────────────────────
+
+// Counters for opt-in page CRC verification, shared by the readers of a
+// file. Pages written without a CRC are counted as unchecked.
+struct PageChecksums {
+    std::atomic<uint64_t> verified{0};
+    std::atomic<uint64_t> failed{0};
+    std::atomic<uint64_t> unchecked{0};
+
+    // Check the stored (compressed) payload of a page against the CRC from
+    // its header. Throws std::runtime_error on a mismatch.
+    void verify(std::optional<int32_t> expected, const uint8_t* data, size_t size);
+
+    void reset() {
+        verified = 0;
+        failed = 0;
+        unchecked = 0;
+    }
+};
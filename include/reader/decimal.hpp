@@ -0,0 +1,113 @@
+#pragma once
+#include "common.hpp"
+#include <cstring>
+
+// ── DECIMAL decoding ───────────────────────────────────────────────────────────
+//
+// FIXED_LEN_BYTE_ARRAY decimals are big-endian two's complement of 1-16
+// bytes. Each value is loaded into the top of a zeroed register, byte-swapped,
+// and arithmetic-shifted down to sign-extend; the width is a template
+// parameter so the load and shift compile to constants.
+
+namespace decimal_detail {
+
+template <size_t W>
+inline __int128 load_be128(const uint8_t* src) {
+    uint8_t tmp[16] = {};
+    std::memcpy(tmp, src, W);
+    uint64_t hi, lo;
+    std::memcpy(&hi, tmp, 8);
+    std::memcpy(&lo, tmp + 8, 8);
+    unsigned __int128 u = (static_cast<unsigned __int128>(__builtin_bswap64(hi)) << 64) |
+                          __builtin_bswap64(lo);
+    return static_cast<__int128>(u) >> ((16 - W) * 8);
+}
+
+template <size_t W>
+inline int64_t load_be64(const uint8_t* src) {
+    uint8_t tmp[8] = {};
+    std::memcpy(tmp, src, W);
+    uint64_t v;
+    std::memcpy(&v, tmp, 8);
+    return static_cast<int64_t>(__builtin_bswap64(v)) >> ((8 - W) * 8);
+}
+
+template <size_t W>
+void decode_be128(const uint8_t* src, size_t count, __int128* out) {
+    for (size_t i = 0; i < count; i++) {
+        __int128 v = load_be128<W>(src + i * W);
+        std::memcpy(out + i, &v, sizeof(v));
+    }
+}
+
+template <size_t W>
+void decode_be64(const uint8_t* src, size_t count, int64_t* out) {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = load_be64<W>(src + i * W);
+    }
+}
+
+} // namespace decimal_detail
+
+// Decode `count` big-endian decimals of `width` bytes (1-16) into __int128.
+// `out` need not be 16-byte aligned.
+inline void decode_decimal128(const uint8_t* src, size_t width, size_t count, __int128* out) {
+    using namespace decimal_detail;
+    switch (width) {
+        case 1:  decode_be128<1>(src, count, out); break;
+        case 2:  decode_be128<2>(src, count, out); break;
+        case 3:  decode_be128<3>(src, count, out); break;
+        case 4:  decode_be128<4>(src, count, out); break;
+        case 5:  decode_be128<5>(src, count, out); break;
+        case 6:  decode_be128<6>(src, count, out); break;
+        case 7:  decode_be128<7>(src, count, out); break;
+        case 8:  decode_be128<8>(src, count, out); break;
+        case 9:  decode_be128<9>(src, count, out); break;
+        case 10: decode_be128<10>(src, count, out); break;
+        case 11: decode_be128<11>(src, count, out); break;
+        case 12: decode_be128<12>(src, count, out); break;
+        case 13: decode_be128<13>(src, count, out); break;
+        case 14: decode_be128<14>(src, count, out); break;
+        case 15: decode_be128<15>(src, count, out); break;
+        case 16: decode_be128<16>(src, count, out); break;
+        default:
+            throw std::runtime_error("DECIMAL: unsupported byte width " + std::to_string(width));
+    }
+}
+
+// Decode `count` big-endian decimals of `width` bytes (1-8) into int64.
+inline void decode_decimal64(const uint8_t* src, size_t width, size_t count, int64_t* out) {
+    using namespace decimal_detail;
+    switch (width) {
+        case 1: decode_be64<1>(src, count, out); break;
+        case 2: decode_be64<2>(src, count, out); break;
+        case 3: decode_be64<3>(src, count, out); break;
+        case 4: decode_be64<4>(src, count, out); break;
+        case 5: decode_be64<5>(src, count, out); break;
+        case 6: decode_be64<6>(src, count, out); break;
+        case 7: decode_be64<7>(src, count, out); break;
+        case 8: decode_be64<8>(src, count, out); break;
+        default:
+            throw std::runtime_error("DECIMAL: byte width " + std::to_string(width) +
+                " does not fit in 64 bits");
+    }
+}
+
+// Render an unscaled decimal with `scale` fractional digits, e.g. 12345 / 2 -> "123.45".
+inline std::string decimal_to_string(__int128 unscaled, int32_t scale) {
+    bool neg = unscaled < 0;
+    unsigned __int128 u = neg ? -static_cast<unsigned __int128>(unscaled)
+                              : static_cast<unsigned __int128>(unscaled);
+    std::string digits;
+    do {
+        digits.push_back(static_cast<char>('0' + static_cast<int>(u % 10)));
+        u /= 10;
+    } while (u != 0);
+    while (scale > 0 && digits.size() <= static_cast<size_t>(scale)) digits.push_back('0');
+    std::string out = neg ? "-" : "";
+    for (size_t i = digits.size(); i-- > 0;) {
+        out.push_back(digits[i]);
+        if (scale > 0 && i == static_cast<size_t>(scale)) out.push_back('.');
+    }
+    return out;
+}
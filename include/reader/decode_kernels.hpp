@@ -0,0 +1,253 @@
+#pragma once
+#include "byte_stream_split.hpp"
+#include "common.hpp"
+#include "delta_decoder.hpp"
+#include "string_arena.hpp"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// ── Page decode kernels ────────────────────────────────────────────────────────
+//
+// Decoding one data page is split into a kernel per (physical type,
+// encoding, REQUIRED) combination, resolved once per page. Inside a kernel
+// the physical type and encoding are compile-time constants, so there is no
+// per-value type switch, and REQUIRED kernels never look at definition
+// levels. Each value still becomes a Value, so these loops do not
+// vectorize; bulk copies of fixed-width pages (one memcpy for a REQUIRED
+// PLAIN INT64 page) are done by the typed ColumnVector path instead.
+
+// Expand one page into `out`: `num_values` level entries, of which the
+// `num_non_null` entries with def_levels[i] == max_def_level carry a value.
+// `def_levels` is unused by REQUIRED kernels. BYTE_ARRAY kernels copy
+// strings into `arena` when one is given.
+using PageKernel = void (*)(ByteBuffer& buf, const int16_t* def_levels, int16_t max_def_level,
+                            size_t num_values, size_t num_non_null, std::vector<Value>& out,
+                            StringArena* arena);
+
+namespace kernel_detail {
+
+template <ParquetType T> struct Physical;
+template <> struct Physical<ParquetType::INT32> {
+    using type = int32_t;
+    static Value make(int32_t v) { return Value::from_i32(v); }
+};
+template <> struct Physical<ParquetType::INT64> {
+    using type = int64_t;
+    static Value make(int64_t v) { return Value::from_i64(v); }
+};
+template <> struct Physical<ParquetType::FLOAT> {
+    using type = float;
+    static Value make(float v) { return Value::from_float(v); }
+};
+template <> struct Physical<ParquetType::DOUBLE> {
+    using type = double;
+    static Value make(double v) { return Value::from_double(v); }
+};
+
+// Append `n` slots and fill the non-null ones from `next()` in order. The
+// appended slots start out null, so OPTIONAL kernels only touch valid ones.
+// Those are found without a branch on the definition levels: each block's
+// slot numbers are compacted into `slots`, every one stored but the count
+// advanced only for a valid slot, and then filled in order.
+template <bool Required, typename Next>
+inline void emit(const int16_t* def_levels, int16_t max_def_level, size_t n,
+                 std::vector<Value>& out, Next&& next) {
+    size_t base = out.size();
+    out.resize(base + n);
+    Value* dst = out.data() + base;
+    if constexpr (Required) {
+        for (size_t i = 0; i < n; i++) dst[i] = next();
+    } else {
+        constexpr size_t BLOCK = 256;
+        uint16_t slots[BLOCK];
+        for (size_t start = 0; start < n; start += BLOCK) {
+            size_t len = std::min(BLOCK, n - start);
+            const int16_t* defs = def_levels + start;
+            size_t valid = 0;
+            for (size_t i = 0; i < len; i++) {
+                slots[valid] = static_cast<uint16_t>(i);
+                valid += defs[i] == max_def_level;
+            }
+            Value* block = dst + start;
+            for (size_t j = 0; j < valid; j++) block[slots[j]] = next();
+        }
+    }
+}
+
+template <ParquetType T, bool Required>
+void plain_fixed(ByteBuffer& buf, const int16_t* def_levels, int16_t max_def_level,
+                 size_t num_values, size_t num_non_null, std::vector<Value>& out,
+                 StringArena* /*arena*/) {
+    using C = typename Physical<T>::type;
+    const uint8_t* src = buf.read_bytes(num_non_null * sizeof(C));
+    emit<Required>(def_levels, max_def_level, num_values, out, [&src] {
+        C v;
+        std::memcpy(&v, src, sizeof(C));
+        src += sizeof(C);
+        return Physical<T>::make(v);
+    });
+}
+
+template <bool Required>
+void plain_boolean(ByteBuffer& buf, const int16_t* def_levels, int16_t max_def_level,
+                   size_t num_values, size_t num_non_null, std::vector<Value>& out,
+                   StringArena* /*arena*/) {
+    const uint8_t* bits = buf.read_bytes((num_non_null + 7) / 8);
+    size_t bit = 0;
+    emit<Required>(def_levels, max_def_level, num_values, out, [bits, &bit] {
+        bool v = (bits[bit / 8] >> (bit % 8)) & 1;
+        bit++;
+        return Value::from_bool(v);
+    });
+}
+
+template <bool Required>
+void plain_byte_array(ByteBuffer& buf, const int16_t* def_levels, int16_t max_def_level,
+                      size_t num_values, size_t /*num_non_null*/, std::vector<Value>& out,
+                      StringArena* arena) {
+    auto next = [&buf] {
+        uint32_t len = buf.read<uint32_t>();
+        return std::string_view(reinterpret_cast<const char*>(buf.read_bytes(len)), len);
+    };
+    if (arena) {
+        emit<Required>(def_levels, max_def_level, num_values, out,
+                       [&] { return Value::from_view(arena->copy(next())); });
+    } else {
+        emit<Required>(def_levels, max_def_level, num_values, out,
+                       [&] { return Value::from_string(std::string(next())); });
+    }
+}
+
+template <ParquetType T, bool Required>
+void byte_stream_split(ByteBuffer& buf, const int16_t* def_levels, int16_t max_def_level,
+                       size_t num_values, size_t num_non_null, std::vector<Value>& out,
+                       StringArena* /*arena*/) {
+    using C = typename Physical<T>::type;
+    const uint8_t* streams = buf.read_bytes(num_non_null * sizeof(C));
+    std::vector<C> decoded(num_non_null);
+    byte_stream_split_decode(streams, num_non_null, sizeof(C), num_non_null,
+                             reinterpret_cast<uint8_t*>(decoded.data()));
+    const C* src = decoded.data();
+    emit<Required>(def_levels, max_def_level, num_values, out,
+                   [&src] { return Physical<T>::make(*src++); });
+}
+
+// Deltas wrap at the physical width, so INT32 pages decode as int32.
+template <ParquetType T, bool Required>
+void delta_binary_packed(ByteBuffer& buf, const int16_t* def_levels, int16_t max_def_level,
+                         size_t num_values, size_t num_non_null, std::vector<Value>& out,
+                         StringArena* /*arena*/) {
+    using C = typename Physical<T>::type;
+    DeltaBinaryPackedDecoder decoder(buf.current(), static_cast<uint32_t>(buf.remaining()));
+    std::vector<C> decoded(num_non_null);
+    decoder.get_batch(decoded.data(), static_cast<uint32_t>(num_non_null));
+    const C* src = decoded.data();
+    emit<Required>(def_levels, max_def_level, num_values, out,
+                   [&src] { return Physical<T>::make(*src++); });
+}
+
+template <ParquetType T>
+PageKernel numeric_kernel(Encoding encoding, bool required) {
+    switch (encoding) {
+        case Encoding::PLAIN:
+            return required ? &plain_fixed<T, true> : &plain_fixed<T, false>;
+        case Encoding::BYTE_STREAM_SPLIT:
+            return required ? &byte_stream_split<T, true> : &byte_stream_split<T, false>;
+        case Encoding::DELTA_BINARY_PACKED:
+            if constexpr (T == ParquetType::INT32 || T == ParquetType::INT64) {
+                return required ? &delta_binary_packed<T, true> : &delta_binary_packed<T, false>;
+            }
+            return nullptr;
+        default:
+            return nullptr;
+    }
+}
+
+} // namespace kernel_detail
+
+// Kernel for a page of `type` values in `encoding`, or nullptr when the
+// combination has no specialized kernel (dictionary pages, FIXED_LEN_BYTE_ARRAY,
+// INT96 and the string delta encodings go through the generic path).
+inline PageKernel select_page_kernel(ParquetType type, Encoding encoding, bool required) {
+    using namespace kernel_detail;
+    switch (type) {
+        case ParquetType::INT32:  return numeric_kernel<ParquetType::INT32>(encoding, required);
+        case ParquetType::INT64:  return numeric_kernel<ParquetType::INT64>(encoding, required);
+        case ParquetType::FLOAT:  return numeric_kernel<ParquetType::FLOAT>(encoding, required);
+        case ParquetType::DOUBLE: return numeric_kernel<ParquetType::DOUBLE>(encoding, required);
+        case ParquetType::BOOLEAN:
+            if (encoding != Encoding::PLAIN) return nullptr;
+            return required ? &plain_boolean<true> : &plain_boolean<false>;
+        case ParquetType::BYTE_ARRAY:
+            if (encoding != Encoding::PLAIN) return nullptr;
+            return required ? &plain_byte_array<true> : &plain_byte_array<false>;
+        default:
+            return nullptr;
+    }
+}
+
+// Expand dictionary indices into `out`. The caller has checked every index
+// against the dictionary size (see max_dictionary_index).
+template <bool Required>
+void gather_dictionary_values(const uint32_t* indices, const Value* dictionary,
+                              const int16_t* def_levels, int16_t max_def_level,
+                              size_t num_values, std::vector<Value>& out) {
+    kernel_detail::emit<Required>(def_levels, max_def_level, num_values, out,
+                                  [&] { return dictionary[*indices++]; });
+}
+
+// ── Typed spread ───────────────────────────────────────────────────────────────
+
+namespace kernel_detail {
+
+template <size_t W>
+void spread_fixed_w(uint8_t* d, const int16_t* def_levels, int16_t max_def_level,
+                    size_t num_values, size_t num_non_null) {
+    size_t k = num_non_null;
+    for (size_t i = num_values; i-- > 0;) {
+        if (def_levels[i] == max_def_level) {
+            k--;
+            std::memmove(d + i * W, d + k * W, W);
+        } else {
+            std::memset(d + i * W, 0, W);
+        }
+    }
+}
+
+} // namespace kernel_detail
+
+// Move `num_non_null` densely decoded values of `width` bytes at `d` out to
+// their slots among `num_values`, back to front so it works in place; null
+// slots are zeroed. Common widths get a kernel with a constant-size copy.
+inline void spread_fixed(uint8_t* d, size_t width, const int16_t* def_levels,
+                         int16_t max_def_level, size_t num_values, size_t num_non_null) {
+    using namespace kernel_detail;
+    switch (width) {
+        case 1:  spread_fixed_w<1>(d, def_levels, max_def_level, num_values, num_non_null); return;
+        case 2:  spread_fixed_w<2>(d, def_levels, max_def_level, num_values, num_non_null); return;
+        case 4:  spread_fixed_w<4>(d, def_levels, max_def_level, num_values, num_non_null); return;
+        case 8:  spread_fixed_w<8>(d, def_levels, max_def_level, num_values, num_non_null); return;
+        case 16: spread_fixed_w<16>(d, def_levels, max_def_level, num_values, num_non_null); return;
+        default: break;
+    }
+    size_t k = num_non_null;
+    for (size_t i = num_values; i-- > 0;) {
+        if (def_levels[i] == max_def_level) {
+            k--;
+            std::memmove(d + i * width, d + k * width, width);
+        } else {
+            std::memset(d + i * width, 0, width);
+        }
+    }
+}
+
+// Set validity bits [base, base + n) from the definition levels without a
+// branch per value. The bitmap must already cover base + n bits, zeroed.
+inline void set_validity_bits(uint8_t* validity, size_t base, const int16_t* def_levels,
+                              int16_t max_def_level, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        size_t bit = base + i;
+        validity[bit / 8] |= static_cast<uint8_t>((def_levels[i] == max_def_level) << (bit % 8));
+    }
+}
@@ -0,0 +1,285 @@
+#pragma once
+#include "common.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// ── DeltaBinaryPackedDecoder ───────────────────────────────────────────────────
+//
+// DELTA_BINARY_PACKED: a header (block size, miniblocks per block, total value
+// count, first value) followed by blocks of (min delta, miniblock bit widths,
+// bit-packed miniblocks). Also used for the length streams of the delta
+// byte-array encodings.
+
+class DeltaBinaryPackedDecoder {
+public:
+    DeltaBinaryPackedDecoder(const uint8_t* data, uint32_t size)
+        : buf_(data, size), values_read_(0), min_delta_(0),
+          miniblock_idx_(0), miniblock_pos_(0) {
+        block_size_ = static_cast<uint32_t>(buf_.read_varint());
+        miniblocks_per_block_ = static_cast<uint32_t>(buf_.read_varint());
+        total_values_ = static_cast<uint32_t>(buf_.read_varint());
+        last_value_ = static_cast<uint64_t>(buf_.read_zigzag());
+
+        if (miniblocks_per_block_ == 0 || block_size_ % miniblocks_per_block_ != 0) {
+            throw std::runtime_error("DELTA_BINARY_PACKED: invalid block layout");
+        }
+        values_per_miniblock_ = block_size_ / miniblocks_per_block_;
+        if (values_per_miniblock_ == 0 || values_per_miniblock_ % 8 != 0) {
+            throw std::runtime_error("DELTA_BINARY_PACKED: invalid miniblock size");
+        }
+        bit_widths_.resize(miniblocks_per_block_);
+        deltas_.resize(values_per_miniblock_);
+        // Force a block header read before the first delta
+        miniblock_idx_ = miniblocks_per_block_;
+        miniblock_pos_ = values_per_miniblock_;
+    }
+
+    uint32_t total_values() const { return total_values_; }
+    uint32_t values_left() const { return total_values_ - values_read_; }
+
+    // Position just past the last consumed miniblock. Once every value has
+    // been read this is the end of the encoded stream.
+    const uint8_t* position() const { return buf_.current(); }
+
+    template <typename T>
+    void get_batch(T* out, uint32_t count) {
+        if (count > values_left()) {
+            throw std::runtime_error("DELTA_BINARY_PACKED: read past end of stream");
+        }
+        uint32_t i = 0;
+        if (count > 0 && values_read_ == 0) {
+            out[i++] = static_cast<T>(last_value_);
+        }
+        while (i < count) {
+            if (miniblock_pos_ == values_per_miniblock_) load_miniblock();
+            uint32_t n = std::min(count - i, values_per_miniblock_ - miniblock_pos_);
+            const uint64_t* d = deltas_.data() + miniblock_pos_;
+            uint64_t v = last_value_;
+            for (uint32_t k = 0; k < n; k++) {
+                v += min_delta_ + d[k];
+                out[i + k] = static_cast<T>(v);
+            }
+            last_value_ = v;
+            miniblock_pos_ += n;
+            i += n;
+        }
+        values_read_ += count;
+    }
+
+    // Unpack `count` little-endian bit-packed values of `bit_width` bits.
+    // `size` bounds the input so the 8-byte fast path never over-reads.
+    static void unpack(const uint8_t* in, size_t size, uint8_t bit_width,
+                       uint64_t* out, uint32_t count) {
+        if (bit_width == 0) {
+            std::fill(out, out + count, 0);
+            return;
+        }
+        const uint64_t mask = bit_width == 64 ? ~uint64_t(0)
+                                              : (uint64_t(1) << bit_width) - 1;
+        uint64_t bit_offset = 0;
+        for (uint32_t i = 0; i < count; i++, bit_offset += bit_width) {
+            size_t byte_idx = static_cast<size_t>(bit_offset / 8);
+            uint32_t shift = static_cast<uint32_t>(bit_offset % 8);
+            if (bit_width <= 56 && byte_idx + 8 <= size) {
+                uint64_t word;
+                std::memcpy(&word, in + byte_idx, 8);
+                out[i] = (word >> shift) & mask;
+            } else {
+                uint64_t v = 0;
+                uint32_t got = 0;
+                while (got < bit_width) {
+                    uint32_t take = std::min<uint32_t>(8 - shift, bit_width - got);
+                    uint64_t bits = (in[byte_idx] >> shift) & ((1u << take) - 1);
+                    v |= bits << got;
+                    got += take;
+                    shift = 0;
+                    byte_idx++;
+                }
+                out[i] = v;
+            }
+        }
+    }
+
+private:
+    void load_miniblock() {
+        if (miniblock_idx_ == miniblocks_per_block_) {
+            min_delta_ = static_cast<uint64_t>(buf_.read_zigzag());
+            const uint8_t* widths = buf_.read_bytes(miniblocks_per_block_);
+            std::memcpy(bit_widths_.data(), widths, miniblocks_per_block_);
+            miniblock_idx_ = 0;
+        }
+        uint8_t bw = bit_widths_[miniblock_idx_++];
+        if (bw > 64) {
+            throw std::runtime_error("DELTA_BINARY_PACKED: invalid bit width " +
+                std::to_string(bw));
+        }
+        size_t bytes = static_cast<size_t>(values_per_miniblock_) * bw / 8;
+        const uint8_t* packed = buf_.read_bytes(bytes);
+        unpack(packed, bytes, bw, deltas_.data(), values_per_miniblock_);
+        miniblock_pos_ = 0;
+    }
+
+    ByteBuffer buf_;
+    uint32_t block_size_;
+    uint32_t miniblocks_per_block_;
+    uint32_t values_per_miniblock_;
+    uint32_t total_values_;
+    uint32_t values_read_;
+
+    // Arithmetic is done modulo 2^64 so INT32 and INT64 wrap as the spec requires
+    uint64_t last_value_;
+    uint64_t min_delta_;
+    std::vector<uint8_t> bit_widths_;
+    std::vector<uint64_t> deltas_;
+    uint32_t miniblock_idx_;
+    uint32_t miniblock_pos_;
+};
+
+// ── DeltaLengthByteArrayDecoder ────────────────────────────────────────────────
+//
+// DELTA_LENGTH_BYTE_ARRAY: all lengths (DELTA_BINARY_PACKED) followed by the
+// concatenated value bytes, which are bulk-copied into the output buffer.
+
+class DeltaLengthByteArrayDecoder {
+public:
+    DeltaLengthByteArrayDecoder(const uint8_t* data, uint32_t size)
+        : value_idx_(0), payload_pos_(0) {
+        DeltaBinaryPackedDecoder len_decoder(data, size);
+        lengths_.resize(len_decoder.total_values());
+        len_decoder.get_batch(lengths_.data(), len_decoder.total_values());
+
+        payload_ = len_decoder.position();
+        payload_size_ = size - static_cast<size_t>(payload_ - data);
+        size_t total = 0;
+        for (uint32_t len : lengths_) total += len;
+        if (total > payload_size_) {
+            throw std::runtime_error("DELTA_LENGTH_BYTE_ARRAY: lengths exceed page data");
+        }
+    }
+
+    uint32_t values_left() const {
+        return static_cast<uint32_t>(lengths_.size()) - value_idx_;
+    }
+
+    // Append the next `count` values to `out`.
+    void decode(ByteArrayBuffer& out, uint32_t count) {
+        check(count);
+        size_t base = out.data.size();
+        size_t old_size = out.offsets.size();
+        out.offsets.resize(old_size + count);
+        uint32_t* offsets = out.offsets.data() + old_size;
+        size_t total = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            total += lengths_[value_idx_ + i];
+            offsets[i] = static_cast<uint32_t>(base + total);
+        }
+        out.data.resize(base + total);
+        std::memcpy(out.data.data() + base, payload_ + payload_pos_, total);
+        payload_pos_ += total;
+        value_idx_ += count;
+    }
+
+    // Raw access for DeltaByteArrayDecoder, which consumes suffixes in place.
+    const uint32_t* next_lengths() const { return lengths_.data() + value_idx_; }
+    const uint8_t* next_bytes() const { return payload_ + payload_pos_; }
+    void advance(uint32_t count, size_t bytes) {
+        check(count);
+        value_idx_ += count;
+        payload_pos_ += bytes;
+    }
+
+private:
+    void check(uint32_t count) const {
+        if (count > values_left()) {
+            throw std::runtime_error("DELTA_LENGTH_BYTE_ARRAY: read past end of stream");
+        }
+    }
+
+    std::vector<uint32_t> lengths_;
+    const uint8_t* payload_;
+    size_t payload_size_;
+    uint32_t value_idx_;
+    size_t payload_pos_;
+};
+
+// ── DeltaByteArrayDecoder ──────────────────────────────────────────────────────
+//
+// DELTA_BYTE_ARRAY (incremental encoding): prefix lengths (DELTA_BINARY_PACKED)
+// followed by suffixes (DELTA_LENGTH_BYTE_ARRAY). Each value is rebuilt in the
+// output buffer from the previous value's prefix and its own suffix, so no
+// per-value string is ever allocated.
+
+class DeltaByteArrayDecoder {
+public:
+    DeltaByteArrayDecoder(const uint8_t* data, uint32_t size)
+        : value_idx_(0), suffixes_(init_prefixes(data, size)) {
+        if (suffixes_.values_left() != prefix_lengths_.size()) {
+            throw std::runtime_error("DELTA_BYTE_ARRAY: prefix/suffix count mismatch");
+        }
+    }
+
+    uint32_t values_left() const { return suffixes_.values_left(); }
+
+    // Append the next `count` values to `out`.
+    void decode(ByteArrayBuffer& out, uint32_t count) {
+        if (count > values_left()) {
+            throw std::runtime_error("DELTA_BYTE_ARRAY: read past end of stream");
+        }
+        if (count == 0) return;
+        const uint32_t* prefixes = prefix_lengths_.data() + value_idx_;
+        const uint32_t* suffix_lens = suffixes_.next_lengths();
+        const uint8_t* suffix = suffixes_.next_bytes();
+
+        // Size the output once; every value is then written in place
+        size_t total = 0;
+        size_t suffix_total = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            total += prefixes[i] + suffix_lens[i];
+            suffix_total += suffix_lens[i];
+        }
+        size_t base = out.data.size();
+        size_t old_size = out.offsets.size();
+        out.data.resize(base + total);
+        out.offsets.resize(old_size + count);
+        char* dst = out.data.data() + base;
+        uint32_t* offsets = out.offsets.data() + old_size;
+
+        // The previous value of the first element lives in last_value_; after
+        // that it is the value just written to `out`.
+        const char* prev = last_value_.data();
+        size_t prev_len = last_value_.size();
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t prefix_len = prefixes[i];
+            if (prefix_len > prev_len) {
+                throw std::runtime_error("DELTA_BYTE_ARRAY: prefix longer than previous value");
+            }
+            std::memcpy(dst, prev, prefix_len);
+            std::memcpy(dst + prefix_len, suffix, suffix_lens[i]);
+            suffix += suffix_lens[i];
+            prev = dst;
+            prev_len = prefix_len + suffix_lens[i];
+            dst += prev_len;
+            offsets[i] = static_cast<uint32_t>(dst - out.data.data());
+        }
+        last_value_.assign(prev, prev_len);
+
+        suffixes_.advance(count, suffix_total);
+        value_idx_ += count;
+    }
+
+private:
+    DeltaLengthByteArrayDecoder init_prefixes(const uint8_t* data, uint32_t size) {
+        DeltaBinaryPackedDecoder prefix_decoder(data, size);
+        prefix_lengths_.resize(prefix_decoder.total_values());
+        prefix_decoder.get_batch(prefix_lengths_.data(), prefix_decoder.total_values());
+        uint32_t consumed = static_cast<uint32_t>(prefix_decoder.position() - data);
+        return DeltaLengthByteArrayDecoder(data + consumed, size - consumed);
+    }
+
+    std::vector<uint32_t> prefix_lengths_;
+    uint32_t value_idx_;
+    DeltaLengthByteArrayDecoder suffixes_;
+    std::string last_value_;
+};
@@ -0,0 +1,90 @@
+#pragma once
+#include "column_vector.hpp"
+#include "common.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// ── DictionaryCache ────────────────────────────────────────────────────────────
+//
+// Decoded dictionary pages keyed by (file path, size, mtime, row group,
+// column), so a file rewritten in place never gets the old dictionaries
+// back. Value dictionaries of INT96 columns are also keyed by their
+// representation (nanoseconds or legacy strings). Entries are immutable
+// and handed out as shared_ptrs, so repeated scans and several iterators
+// over the same column decode a dictionary once and share it; an entry
+// stays alive while anyone still holds it, even after it is evicted or
+// clear()ed.
+//
+// Each dictionary is cached in the form its consumer decodes into: Value
+// entries (owned strings) for the Value API, and a ColumnVector for typed
+// decoding and StringColumnIterator. Once the estimated footprint of the
+// entries exceeds the memory budget the least recently used ones are
+// evicted. A cache can be shared by several ParquetReader instances; access
+// is thread-safe.
+
+class DictionaryCache {
+public:
+    static constexpr size_t DEFAULT_BUDGET = 64 * MB;
+
+    struct Key {
+        std::string file;
+        uint64_t size = 0;
+        int64_t mtime = 0;  // last write time in file clock ticks
+        int row_group = 0;
+        int column = 0;
+        bool int96_as_string = false;  // Value entries of INT96 columns only
+
+        bool operator<(const Key& o) const {
+            return std::tie(row_group, column, int96_as_string, size, mtime, file) <
+                   std::tie(o.row_group, o.column, o.int96_as_string, o.size, o.mtime, o.file);
+        }
+    };
+
+    using Values = std::shared_ptr<const std::vector<Value>>;
+    using Vector = std::shared_ptr<const ColumnVector>;
+
+    explicit DictionaryCache(size_t budget_bytes = DEFAULT_BUDGET) : budget_(budget_bytes) {}
+
+    // Both mark the entry most recently used.
+    Values find_values(const Key& key);
+    Vector find_vector(const Key& key);
+
+    // Store a freshly decoded dictionary. If another reader stored one for
+    // the same key in the meantime, that entry wins and is returned. A
+    // dictionary larger than the whole budget is returned uncached.
+    Values store_values(const Key& key, std::vector<Value> dict);
+    Vector store_vector(const Key& key, ColumnVector dict);
+
+    // Lowering the budget evicts down to it.
+    void set_budget(size_t budget_bytes);
+    size_t budget() const;
+    size_t memory_usage() const;
+    size_t size() const;
+    void clear();
+
+private:
+    struct Node {
+        Key key;
+        Values values;  // exactly one of values / vector is set
+        Vector vector;
+        size_t bytes;
+    };
+    using Index = std::map<Key, std::list<Node>::iterator>;
+
+    void insert(Index& index, Node node);  // with mutex_ held
+    void evict_over_budget();              // with mutex_ held
+
+    mutable std::mutex mutex_;
+    size_t budget_;
+    size_t used_ = 0;
+    std::list<Node> lru_;  // most recently used first
+    Index values_;
+    Index vectors_;
+};
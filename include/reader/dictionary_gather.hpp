@@ -0,0 +1,21 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// ── Dictionary gather ──────────────────────────────────────────────────────────
+//
+// Expand dictionary indices into fixed-width values: out[i] = dict[indices[i]]
+// for `count` values of `width` bytes. Indices must already be bounds-checked
+// (see max_dictionary_index). Widths 4 and 8 use AVX2 gathers when the CPU
+// has them (chosen once at runtime); other common widths use unrolled
+// constant-size copies.
+
+void dictionary_gather(const uint8_t* dict, size_t width, const uint32_t* indices,
+                       size_t count, uint8_t* out);
+
+// Portable reference implementation, also used for tails and odd widths.
+void dictionary_gather_scalar(const uint8_t* dict, size_t width, const uint32_t* indices,
+                              size_t count, uint8_t* out);
+
+// Largest of `count` indices (0 when empty), for a single bounds check per page.
+uint32_t max_dictionary_index(const uint32_t* indices, size_t count);
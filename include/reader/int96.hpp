@@ -0,0 +1,38 @@
+#pragma once
+#include "common.hpp"
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+// ── INT96 timestamps ───────────────────────────────────────────────────────────
+//
+// Legacy Impala/Hive timestamps: 8 bytes of nanoseconds within the day
+// followed by a 4-byte Julian day number, both little-endian.
+
+static constexpr int64_t INT96_JULIAN_UNIX_EPOCH = 2440588;  // 1970-01-01
+static constexpr int64_t INT96_NANOS_PER_DAY = 86400LL * 1000000000LL;
+
+// Nanoseconds since the Unix epoch fit in an int64 only from 1677-09-21 to
+// 2262-04-11; a timestamp outside that range (e.g. the 0001-01-01 sentinel
+// some writers use) throws rather than wrapping.
+inline int64_t int96_to_nanos(const uint8_t* src) {
+    int64_t nanos_of_day;
+    int32_t julian_day;
+    std::memcpy(&nanos_of_day, src, 8);
+    std::memcpy(&julian_day, src + 8, 4);
+    int64_t nanos;
+    if (__builtin_mul_overflow(static_cast<int64_t>(julian_day) - INT96_JULIAN_UNIX_EPOCH,
+                               INT96_NANOS_PER_DAY, &nanos) ||
+        __builtin_add_overflow(nanos, nanos_of_day, &nanos)) {
+        throw std::runtime_error("INT96 timestamp out of range for nanoseconds (Julian day " +
+                                 std::to_string(julian_day) + ")");
+    }
+    return nanos;
+}
+
+// Decode `count` packed 12-byte INT96 values into nanoseconds since the Unix epoch.
+inline void decode_int96_nanos(const uint8_t* src, size_t count, int64_t* out) {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = int96_to_nanos(src + i * 12);
+    }
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "thrift.hpp"
+#include <memory>
 #include <optional>
 #include <vector>
 #include <string>
@@ -20,18 +21,34 @@ struct SchemaElement {
     void deserialize(ThriftReader& reader);
 };
 
-// ── Statistics (simplified, just skip) ─────────────────────────────────────────
+// ── Statistics ─────────────────────────────────────────────────────────────────
 
+// Min/max are kept as the encoded bytes (PLAIN encoding without the length
+// prefix); decode_statistics() turns them into typed values. `min` / `max`
+// are the deprecated fields written with signed comparisons.
 struct Statistics {
+    std::optional<std::string> max;
+    std::optional<std::string> min;
+    std::optional<int64_t> null_count;
+    std::optional<int64_t> distinct_count;
+    std::optional<std::string> max_value;
+    std::optional<std::string> min_value;
+    std::optional<bool> is_max_value_exact;
+    std::optional<bool> is_min_value_exact;
+
     void deserialize(ThriftReader& reader);
 };
 
 // ── ColumnMetaData ─────────────────────────────────────────────────────────────
 
+// Every row group repeats a column's path, so chunks of the same column
+// share one immutable copy.
+using ColumnPath = std::shared_ptr<const std::vector<std::string>>;
+
 struct ColumnMetaData {
     ParquetType type = ParquetType::INT32;
     std::vector<Encoding> encodings;
-    std::vector<std::string> path_in_schema;
+    ColumnPath path_in_schema;  // null if the file omits it
     CompressionCodec codec = CompressionCodec::UNCOMPRESSED;
     int64_t num_values = 0;
     int64_t total_uncompressed_size = 0;
@@ -39,16 +56,113 @@ struct ColumnMetaData {
     int64_t data_page_offset = 0;
     std::optional<int64_t> index_page_offset;
     std::optional<int64_t> dictionary_page_offset;
+    std::optional<Statistics> statistics;
+    std::optional<int64_t> bloom_filter_offset;
+    std::optional<int32_t> bloom_filter_length;  // header + bitset, when written
+
+    // `previous` is the same column's metadata in another row group; an
+    // equal path is shared with it instead of being copied.
+    void deserialize(ThriftReader& reader, const ColumnMetaData* previous = nullptr);
+};
+
+// ── BloomFilterHeader ──────────────────────────────────────────────────────────
+
+// Precedes the bitset at ColumnMetaData::bloom_filter_offset. The algorithm,
+// hash and compression unions each have a single option today (split
+// block, XXH64, uncompressed); the flags record whether it was chosen.
+struct BloomFilterHeader {
+    int32_t num_bytes = 0;
+    bool split_block = false;
+    bool xxhash = false;
+    bool uncompressed = false;
 
     void deserialize(ThriftReader& reader);
 };
 
 // ── ColumnChunk ────────────────────────────────────────────────────────────────
 
+// The ColumnMetaData is held out of line: wide schemas have thousands of
+// chunks per row group and most of them are never decoded (see below).
 struct ColumnChunk {
     std::optional<std::string> file_path;
     int64_t file_offset = 0;
-    std::optional<ColumnMetaData> meta_data;
+    std::shared_ptr<const ColumnMetaData> meta_data;
+    std::optional<int64_t> offset_index_offset;
+    std::optional<int32_t> offset_index_length;
+    std::optional<int64_t> column_index_offset;
+    std::optional<int32_t> column_index_length;
+
+    // A lazily parsed footer leaves meta_data empty and records where the
+    // ColumnMetaData struct lies in the footer (size 0 if there is none).
+    size_t meta_data_offset = 0;
+    size_t meta_data_size = 0;
+
+    void deserialize(ThriftReader& reader, bool lazy = false,
+                     const ColumnChunk* previous = nullptr);
+    // Decode the recorded ColumnMetaData from the footer bytes it was
+    // parsed from, sharing the path of `previous` (another row group's
+    // chunk of the column) when it matches.
+    void decode_meta_data(const uint8_t* footer, const ColumnChunk* previous = nullptr);
+};
+
+// ── ChunkTable ─────────────────────────────────────────────────────────────────
+
+// The numeric ColumnMetaData fields the reader walks on every scan, stored
+// as one array per field in column-major order: the chunks of one column
+// across all row groups are adjacent. Filled straight from the footer, so
+// no strings or statistics are decoded for it.
+struct ChunkTable {
+    size_t num_row_groups = 0;
+    size_t num_columns = 0;
+    std::vector<int64_t> data_page_offset;
+    std::vector<int64_t> dictionary_page_offset;  // -1 if there is no dictionary page
+    std::vector<int64_t> total_compressed_size;
+    std::vector<int64_t> total_uncompressed_size;
+    std::vector<int64_t> num_values;               // 0 for chunks without metadata
+    std::vector<CompressionCodec> codec;
+
+    void resize(size_t row_groups, size_t columns);
+    size_t index(size_t row_group_idx, size_t col_idx) const {
+        return col_idx * num_row_groups + row_group_idx;
+    }
+    // Offset of the chunk's first page, dictionary page included
+    int64_t start_offset(size_t i) const {
+        int64_t dict = dictionary_page_offset[i];
+        return dict >= 0 && dict < data_page_offset[i] ? dict : data_page_offset[i];
+    }
+    // Record `chunk`, reading its undecoded ColumnMetaData from `footer`.
+    void assign(size_t row_group_idx, size_t col_idx, const ColumnChunk& chunk,
+                const uint8_t* footer);
+};
+
+// ── OffsetIndex ────────────────────────────────────────────────────────────────
+
+// Location of one data page; `compressed_page_size` includes the page header.
+struct PageLocation {
+    int64_t offset = 0;
+    int32_t compressed_page_size = 0;
+    int64_t first_row_index = 0;
+
+    void deserialize(ThriftReader& reader);
+};
+
+struct OffsetIndex {
+    std::vector<PageLocation> page_locations;
+    std::vector<int64_t> unencoded_byte_array_data_bytes;
+
+    void deserialize(ThriftReader& reader);
+};
+
+// ── ColumnIndex ────────────────────────────────────────────────────────────────
+
+// Per-page min/max of a column chunk, encoded like Statistics::min_value /
+// max_value. Bounds of pages listed in `null_pages` are empty.
+struct ColumnIndex {
+    std::vector<bool> null_pages;
+    std::vector<std::string> min_values;
+    std::vector<std::string> max_values;
+    BoundaryOrder boundary_order = BoundaryOrder::UNORDERED;
+    std::vector<int64_t> null_counts;
 
     void deserialize(ThriftReader& reader);
 };
@@ -60,8 +174,29 @@ struct DataPageHeader {
     Encoding encoding = Encoding::PLAIN;
     Encoding definition_level_encoding = Encoding::RLE;
     Encoding repetition_level_encoding = Encoding::RLE;
+    std::optional<Statistics> statistics;
 
-    void deserialize(ThriftReader& reader);
+    // `skip_statistics` skips field 5 without copying its min / max, for
+    // page walks that keep only a CachedPageHeader.
+    void deserialize(ThriftReader& reader, bool skip_statistics = false);
+};
+
+// ── DataPageHeaderV2 ───────────────────────────────────────────────────────────
+
+// The levels of a DATA_PAGE_V2 page are stored uncompressed ahead of the
+// values, repetition levels first; only the values are compressed, and
+// only when `is_compressed`.
+struct DataPageHeaderV2 {
+    int32_t num_values = 0;
+    int32_t num_nulls = 0;
+    int32_t num_rows = 0;
+    Encoding encoding = Encoding::PLAIN;
+    int32_t definition_levels_byte_length = 0;
+    int32_t repetition_levels_byte_length = 0;
+    bool is_compressed = true;
+    std::optional<Statistics> statistics;
+
+    void deserialize(ThriftReader& reader, bool skip_statistics = false);
 };
 
 // ── DictionaryPageHeader ───────────────────────────────────────────────────────
@@ -83,6 +218,19 @@ struct PageHeader {
     std::optional<int32_t> crc;
     std::optional<DataPageHeader> data_page_header;
     std::optional<DictionaryPageHeader> dictionary_page_header;
+    std::optional<DataPageHeaderV2> data_page_header_v2;
+
+    // `skip_statistics` is passed on to the data page header
+    void deserialize(ThriftReader& reader, bool skip_statistics = false);
+};
+
+// ── SortingColumn ──────────────────────────────────────────────────────────────
+
+// One sort key of a row group's rows; `column_idx` is the leaf column index.
+struct SortingColumn {
+    int32_t column_idx = 0;
+    bool descending = false;
+    bool nulls_first = false;
 
     void deserialize(ThriftReader& reader);
 };
@@ -93,8 +241,10 @@ struct RowGroup {
     std::vector<ColumnChunk> columns;
     int64_t total_byte_size = 0;
     int64_t num_rows = 0;
+    std::vector<SortingColumn> sorting_columns;  // most significant key first
 
-    void deserialize(ThriftReader& reader);
+    // `previous` is the preceding row group, whose column paths are shared
+    void deserialize(ThriftReader& reader, bool lazy = false, const RowGroup* previous = nullptr);
 };
 
 // ── KeyValue ───────────────────────────────────────────────────────────────────
@@ -116,5 +266,8 @@ struct FileMetaData {
     std::vector<KeyValue> key_value_metadata;
     std::optional<std::string> created_by;
 
-    void deserialize(ThriftReader& reader);
+    // With `lazy`, the ColumnMetaData of every column chunk is skipped and
+    // only located (see ColumnChunk::decode_meta_data); the reader's buffer
+    // must then outlive the decoding.
+    void deserialize(ThriftReader& reader, bool lazy = false);
 };
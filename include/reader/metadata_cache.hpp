@@ -0,0 +1,127 @@
+#pragma once
+#include "common.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+struct ParsedFile;
+
+// ── GrowthTracker ──────────────────────────────────────────────────────────────
+//
+// Bytes a shared ParsedFile has grown by since it was created. While the
+// file is held by a MetadataCache each addition is also reported to the
+// cache's pending total, so charging it costs nothing per entry.
+
+class GrowthTracker {
+public:
+    void add(size_t bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        total_ += bytes;
+        if (sink_) sink_->fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    size_t total() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return total_;
+    }
+
+    // Report later additions to `sink`, or to no one when it is nullptr.
+    // Returns the total so far, which the previous sink has been sent.
+    size_t attach(std::atomic<size_t>* sink) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sink_ = sink;
+        return total_;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    size_t total_ = 0;
+    std::atomic<size_t>* sink_ = nullptr;
+};
+
+// ── MetadataCache ──────────────────────────────────────────────────────────────
+//
+// Parsed footers and page indexes keyed by (path, size, mtime), shared by
+// ParquetReader instances so reopening an unchanged file reads no metadata.
+// Entries are handed out as shared_ptrs and are not replaced, but they grow
+// as readers decode ColumnMetaData on first use and record page headers.
+// That growth is reported as it happens and charged on the next access.
+// Once the estimated footprint exceeds
+// the memory budget the least recently used entries are evicted; an
+// evicted entry stays alive while a reader still holds it. Access is
+// thread-safe.
+
+class MetadataCache {
+public:
+    static constexpr size_t DEFAULT_BUDGET = 256 * MB;
+
+    struct Key {
+        std::string path;
+        uint64_t size = 0;
+        int64_t mtime = 0;  // last write time in file clock ticks
+
+        bool operator==(const Key& o) const {
+            return size == o.size && mtime == o.mtime && path == o.path;
+        }
+    };
+
+    using Entry = std::shared_ptr<const ParsedFile>;
+
+    explicit MetadataCache(size_t budget_bytes = DEFAULT_BUDGET) : budget_(budget_bytes) {}
+    ~MetadataCache();
+    MetadataCache(const MetadataCache&) = delete;
+    MetadataCache& operator=(const MetadataCache&) = delete;
+
+    // Process-wide instance with the default budget. Readers only use it
+    // once it is passed to ParquetReader::set_metadata_cache().
+    static std::shared_ptr<MetadataCache> global();
+
+    // Marks the entry most recently used. Like insert() and set_budget(),
+    // charges the growth reported since the last access and evicts down to
+    // the budget.
+    Entry find(const Key& key);
+
+    // Store a freshly parsed file whose footprint is `bytes`. If another
+    // reader stored the same key in the meantime, that entry wins and is
+    // returned. A file larger than the whole budget is returned uncached.
+    Entry insert(const Key& key, Entry file, size_t bytes);
+
+    // Lowering the budget evicts down to it.
+    void set_budget(size_t budget_bytes);
+    size_t budget() const;
+    // Including growth not charged yet
+    size_t memory_usage() const;
+    size_t size() const;
+    uint64_t hits() const;
+    uint64_t misses() const;
+    void clear();
+
+private:
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+    struct Node {
+        Key key;
+        Entry file;
+        size_t bytes;   // footprint when inserted
+        size_t growth;  // the file's growth when inserted
+    };
+
+    void charge_growth();      // with mutex_ held
+    void evict_over_budget();  // with mutex_ held
+    void detach(Node& node);   // with mutex_ held; uncharges the node
+
+    mutable std::mutex mutex_;
+    size_t budget_;
+    size_t used_ = 0;                       // including charged growth
+    std::atomic<size_t> pending_growth_{0}; // reported by entries, not charged yet
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+    std::list<Node> lru_;  // most recently used first
+    std::unordered_map<Key, std::list<Node>::iterator, KeyHash> index_;
+};
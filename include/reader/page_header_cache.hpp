@@ -0,0 +1,187 @@
+#pragma once
+#include "common.hpp"
+#include "metadata.hpp"
+#include "metadata_cache.hpp"
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+// ── CachedPageHeader ───────────────────────────────────────────────────────────
+//
+// A decoded page header in fixed-size form, so a whole chunk's headers fit
+// in one flat array and need no Thrift decoding once recorded. Page
+// statistics are not kept, so the walks recording it skip them.
+
+struct CachedPageHeader {
+    uint64_t offset = 0;        // file offset of the header
+    uint32_t header_size = 0;   // Thrift-encoded header bytes
+    int32_t compressed_page_size = 0;
+    int32_t uncompressed_page_size = 0;
+    int32_t num_values = 0;     // of the data or dictionary page header
+    int32_t crc = 0;
+    PageType type = PageType::DATA_PAGE;
+    uint8_t encoding = 0;
+    uint8_t definition_level_encoding = 0;
+    uint8_t repetition_level_encoding = 0;
+    uint8_t flags = 0;
+    // DATA_PAGE_V2: the uncompressed level bytes ahead of the values
+    uint32_t definition_levels_size = 0;
+    uint32_t repetition_levels_size = 0;
+
+    static constexpr uint8_t HAS_CRC = 1;
+    static constexpr uint8_t HAS_DATA_PAGE_HEADER = 2;
+    static constexpr uint8_t HAS_DICTIONARY_PAGE_HEADER = 4;
+    static constexpr uint8_t IS_SORTED = 8;
+    static constexpr uint8_t HAS_DATA_PAGE_HEADER_V2 = 16;
+    static constexpr uint8_t VALUES_UNCOMPRESSED = 32;  // DATA_PAGE_V2 is_compressed unset
+
+    static CachedPageHeader from(const PageHeader& header, size_t offset, size_t header_size) {
+        CachedPageHeader page;
+        page.offset = offset;
+        page.header_size = static_cast<uint32_t>(header_size);
+        page.compressed_page_size = header.compressed_page_size;
+        page.uncompressed_page_size = header.uncompressed_page_size;
+        page.type = header.type;
+        if (header.crc) {
+            page.crc = *header.crc;
+            page.flags |= HAS_CRC;
+        }
+        if (const auto& dph = header.data_page_header) {
+            page.num_values = dph->num_values;
+            page.encoding = static_cast<uint8_t>(dph->encoding);
+            page.definition_level_encoding = static_cast<uint8_t>(dph->definition_level_encoding);
+            page.repetition_level_encoding = static_cast<uint8_t>(dph->repetition_level_encoding);
+            page.flags |= HAS_DATA_PAGE_HEADER;
+        } else if (const auto& dict = header.dictionary_page_header) {
+            page.num_values = dict->num_values;
+            page.encoding = static_cast<uint8_t>(dict->encoding);
+            page.flags |= HAS_DICTIONARY_PAGE_HEADER | (dict->is_sorted ? IS_SORTED : 0);
+        } else if (const auto& v2 = header.data_page_header_v2) {
+            page.num_values = v2->num_values;
+            page.encoding = static_cast<uint8_t>(v2->encoding);
+            page.definition_levels_size = static_cast<uint32_t>(v2->definition_levels_byte_length);
+            page.repetition_levels_size = static_cast<uint32_t>(v2->repetition_levels_byte_length);
+            page.flags |= HAS_DATA_PAGE_HEADER_V2 | (v2->is_compressed ? 0 : VALUES_UNCOMPRESSED);
+        }
+        return page;
+    }
+
+    // The header as decoded, without page statistics, which are not kept,
+    // nor the null and row counts of a DATA_PAGE_V2 header.
+    PageHeader header() const {
+        PageHeader h;
+        h.type = type;
+        h.compressed_page_size = compressed_page_size;
+        h.uncompressed_page_size = uncompressed_page_size;
+        if (flags & HAS_CRC) h.crc = crc;
+        if (flags & HAS_DATA_PAGE_HEADER) {
+            DataPageHeader& dph = h.data_page_header.emplace();
+            dph.num_values = num_values;
+            dph.encoding = static_cast<Encoding>(encoding);
+            dph.definition_level_encoding = static_cast<Encoding>(definition_level_encoding);
+            dph.repetition_level_encoding = static_cast<Encoding>(repetition_level_encoding);
+        } else if (flags & HAS_DICTIONARY_PAGE_HEADER) {
+            DictionaryPageHeader& dict = h.dictionary_page_header.emplace();
+            dict.num_values = num_values;
+            dict.encoding = static_cast<Encoding>(encoding);
+            dict.is_sorted = flags & IS_SORTED;
+        } else if (flags & HAS_DATA_PAGE_HEADER_V2) {
+            DataPageHeaderV2& v2 = h.data_page_header_v2.emplace();
+            v2.num_values = num_values;
+            v2.encoding = static_cast<Encoding>(encoding);
+            v2.definition_levels_byte_length = static_cast<int32_t>(definition_levels_size);
+            v2.repetition_levels_byte_length = static_cast<int32_t>(repetition_levels_size);
+            v2.is_compressed = !(flags & VALUES_UNCOMPRESSED);
+        }
+        return h;
+    }
+
+    // Data page values the page contributes to its chunk's num_values
+    int64_t data_values() const {
+        bool data = (type == PageType::DATA_PAGE && (flags & HAS_DATA_PAGE_HEADER)) ||
+                    (type == PageType::DATA_PAGE_V2 && (flags & HAS_DATA_PAGE_HEADER_V2));
+        return data ? num_values : 0;
+    }
+
+    // Level bytes a DATA_PAGE_V2 page stores uncompressed before its values
+    size_t levels_size() const {
+        return static_cast<size_t>(definition_levels_size) + repetition_levels_size;
+    }
+
+    size_t data_offset() const { return offset + header_size; }
+    size_t end_offset() const { return data_offset() + static_cast<size_t>(compressed_page_size); }
+};
+
+// ── PageHeaderCache ────────────────────────────────────────────────────────────
+//
+// The page headers of column chunks keyed by (row group, column chunk), in
+// page order from the chunk's first page through the one that completes
+// its num_values. The first walk over a chunk records them; later walks,
+// by any reader sharing the cache, iterate the array and read only page
+// payloads. Entries are immutable and handed out as shared_ptrs; access is
+// thread-safe. The bytes of each stored chunk are added to `growth`, so a
+// MetadataCache holding the file can charge them.
+
+class PageHeaderCache {
+public:
+    explicit PageHeaderCache(GrowthTracker* growth = nullptr) : growth_(growth) {}
+
+    struct Key {
+        size_t row_group = 0;
+        size_t column = 0;  // column chunk index within the row group
+
+        bool operator<(const Key& o) const {
+            return std::tie(row_group, column) < std::tie(o.row_group, o.column);
+        }
+    };
+
+    using Headers = std::shared_ptr<const std::vector<CachedPageHeader>>;
+
+    Headers find(const Key& key) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = headers_.find(key);
+        return it == headers_.end() ? nullptr : it->second;
+    }
+
+    // Store the headers of a completed walk. If another reader stored the
+    // same chunk in the meantime, that entry wins and is returned.
+    Headers store(const Key& key, std::vector<CachedPageHeader> headers) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& slot = headers_[key];
+        if (!slot) {
+            slot = std::make_shared<const std::vector<CachedPageHeader>>(std::move(headers));
+            size_t bytes = entry_bytes(*slot);
+            bytes_ += bytes;
+            if (growth_) growth_->add(bytes);
+        }
+        return slot;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        headers_.clear();
+        bytes_ = 0;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return headers_.size();
+    }
+
+    // Bytes held by the cached arrays and their map nodes
+    size_t memory_usage() const { return bytes_.load(std::memory_order_relaxed); }
+
+private:
+    static size_t entry_bytes(const std::vector<CachedPageHeader>& headers) {
+        return sizeof(Key) + sizeof(Headers) + 4 * sizeof(void*) +
+               sizeof(headers) + headers.capacity() * sizeof(CachedPageHeader);
+    }
+
+    mutable std::mutex mutex_;
+    std::map<Key, Headers> headers_;
+    std::atomic<size_t> bytes_{0};
+    GrowthTracker* growth_;
+};
@@ -0,0 +1,83 @@
+#pragma once
+#include "column_reader.hpp"
+#include "compression.hpp"
+#include "crc32.hpp"
+#include "metadata.hpp"
+#include "page_header_cache.hpp"
+#include "thread_pool.hpp"
+#include <deque>
+#include <future>
+#include <memory>
+#include <vector>
+
+// ── PagePipeline ───────────────────────────────────────────────────────────────
+//
+// Walks the pages of one column chunk ahead of the decoder. Headers and
+// stored payloads are read on the calling thread, in file order; the
+// payloads are decompressed on `pool` while the decoder works on earlier
+// pages, and handed over in order. Up to `depth` pages are in flight. The
+// pipeline shares ownership of `pool`, so the reader may replace its pool
+// while the walk is under way. With no pool every page is decompressed
+// inline when it is requested. Given
+// `checksums`, each page's CRC is verified alongside its decompression and
+// a mismatch is rethrown from next(); queued pages use `checksums`, so the
+// destructor waits for them.
+
+class PagePipeline {
+public:
+    struct Page {
+        PageHeader header;
+        std::vector<uint8_t> data;  // uncompressed payload
+    };
+
+    PagePipeline(ReadRangeFunc read_range, const ColumnMetaData& meta,
+                 std::shared_ptr<ThreadPool> pool, size_t depth,
+                 PageChecksums* checksums = nullptr);
+    ~PagePipeline();
+
+    PagePipeline(const PagePipeline&) = delete;
+    PagePipeline& operator=(const PagePipeline&) = delete;
+
+    // Iterate the chunk's page headers from `cache` under `key` when they
+    // were recorded there, otherwise record them once the walk completes.
+    // Call before the first next().
+    void set_page_header_cache(PageHeaderCache* cache, PageHeaderCache::Key key);
+
+    // Hand the dictionary page over with its header only, neither reading
+    // nor decompressing its payload, for callers that already hold the
+    // decoded dictionary. Call before the first next().
+    void skip_dictionary_page() { skip_dictionary_ = true; }
+
+    // Move the next page of the chunk into `page`; false once the chunk's
+    // pages are exhausted. The buffer `page.data` held before is reused
+    // for a later page.
+    bool next(Page& page);
+
+private:
+    struct Pending {
+        PageHeader header;
+        std::future<std::vector<uint8_t>> data;
+    };
+
+    void fill();
+
+    ReadRangeFunc read_range_;
+    DecompressFunc decompress_ = nullptr;
+    std::shared_ptr<ThreadPool> pool_;
+    PageChecksums* checksums_;
+    size_t depth_;
+    bool skip_dictionary_ = false;
+
+    size_t offset_;
+    int64_t values_scanned_ = 0;  // data page values whose pages were queued
+    int64_t num_values_;
+
+    PageHeaderCache* header_cache_ = nullptr;
+    PageHeaderCache::Key header_key_;
+    PageHeaderCache::Headers headers_;           // recorded by an earlier walk
+    size_t next_header_ = 0;
+    std::vector<CachedPageHeader> recorded_;     // this walk's, without headers_
+
+    std::deque<Pending> pending_;
+    std::vector<std::vector<uint8_t>> free_buffers_;
+};
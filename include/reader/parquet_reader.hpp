@@ -1,8 +1,21 @@
 #pragma once
+#include "bloom_filter.hpp"
 #include "column_info.hpp"
 #include "column_reader.hpp"
+#include "crc32.hpp"
 #include "metadata.hpp"
+#include "metadata_cache.hpp"
+#include "page_header_cache.hpp"
+#include "page_pipeline.hpp"
+#include "statistics.hpp"
+#include "thread_pool.hpp"
+#include <atomic>
+#include <deque>
 #include <fstream>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <tuple>
@@ -11,9 +24,86 @@
 
 struct PageIndexEntry {
     size_t data_offset;    // file offset where the page data starts (after header)
-    size_t data_size;      // compressed_page_size (raw data length)
+    size_t data_size;      // compressed_page_size (stored data length)
     size_t row_group_idx;  // which row group
     size_t column_idx;     // which column (leaf column index)
+    size_t uncompressed_size;
+    CompressionCodec codec;
+    std::optional<int32_t> crc;  // CRC32 of the stored data, when written
+    size_t page_offset;    // file offset of the page header
+    size_t page_size;      // header + stored data
+    // File row of the page's first row; -1 for pages of repeated columns
+    // without an OffsetIndex, whose headers do not say where rows start
+    int64_t first_row = -1;
+    // Pages located through the file's OffsetIndex are not touched when the
+    // file is opened; the fields above that come from the page header are
+    // filled in by page_index_entry() once the page is first read or looked up.
+    bool header_read = true;
+    // DATA_PAGE_V2 pages store their levels uncompressed ahead of the
+    // values, and the values themselves only compressed if the header says
+    // so; read_page_data() decompresses just those values.
+    size_t levels_size = 0;
+    bool values_compressed = true;
+
+    // Length of the page data as returned by read_page_data()
+    size_t payload_size() const {
+        bool compressed = codec != CompressionCodec::UNCOMPRESSED && values_compressed;
+        return compressed ? uncompressed_size : data_size;
+    }
+};
+
+// Where a file row lies: page `page_id` of the page index, `slot` rows
+// into it. For non-repeated columns the slot is also the value's index in
+// the decoded page.
+struct RowLocation {
+    size_t row_group_idx;
+    size_t page_id;
+    int64_t slot;
+};
+
+// Everything open() derives from a file's footer: the parsed metadata, the
+// leaf columns and the page index. Readers share it through MetadataCache,
+// so after open() it only grows: the ColumnMetaData of chunks is decoded on
+// first use under decode_mutex, and page headers are recorded by scans.
+// Only the mutable members change once it is shared, each under its own
+// lock. Their growth is reported to `growth` so the cache can charge it.
+// Projected opens are never cached.
+struct ParsedFile {
+    // Its ColumnChunk::meta_data are decoded from `footer` on first use, by
+    // column_chunk_meta() under decode_mutex; nothing else in it changes
+    mutable FileMetaData metadata;
+    std::vector<uint8_t> footer;   // ColumnMetaData of undecoded chunks
+    mutable std::mutex decode_mutex;
+    ChunkTable chunks;             // filled for projected columns
+    std::vector<bool> projected;   // by column chunk index; empty when all are
+    std::vector<ColumnInfo> columns;
+    std::unordered_map<std::string, size_t> column_name_to_idx;
+    std::vector<PageIndexEntry> page_index;
+    std::vector<int64_t> row_group_first_row;  // cumulative num_rows, plus the total
+
+    // Data pages of one column chunk within page_index, plus the chunk's
+    // page index structures when the file has them (held out of line, as
+    // most chunks of wide files have none)
+    struct ChunkPages {
+        size_t first_page_id = 0;
+        size_t num_pages = 0;
+        std::unique_ptr<OffsetIndex> offset_index;
+        std::unique_ptr<ColumnIndex> column_index;
+    };
+    std::vector<std::vector<ChunkPages>> chunk_pages;  // [row group][column chunk]
+
+    // Bytes of ColumnMetaData decoded and page headers recorded since
+    // the file was created
+    mutable GrowthTracker growth;
+
+    // Page headers walked at open or by later scans, for every reader of
+    // the file
+    mutable PageHeaderCache page_headers{&growth};
+
+    // Estimated heap footprint, for the cache's memory budget
+    size_t memory_usage() const;
+    // Part of it held by one decoded chunk's ColumnMetaData
+    size_t chunk_meta_bytes(size_t row_group_idx, size_t col_idx) const;
 };
 
 struct RawPage {
@@ -36,6 +126,7 @@ private:
 
     bool decode_next_page();
     void init_row_group();
+    void load_dictionary(const PagePipeline::Page& page);
     static uint8_t bit_width(int16_t max_level);
 
     ParquetReader& reader_;
@@ -44,16 +135,20 @@ private:
     size_t rg_idx_;
     size_t num_row_groups_;
 
-    size_t cur_offset_;
-    int64_t values_read_;
+    std::unique_ptr<PagePipeline> pipeline_;
+    PagePipeline::Page page_;
+    int64_t values_read_;   // level entries consumed in this row group
+    size_t rows_read_;      // rows those entries span (differs for repeated columns)
     int64_t total_values_;
 
-    bool has_dict_;
-    std::vector<std::string> dictionary_;
+    DictionaryCache::Vector dictionary_;
 
     size_t row_group_base_;
 
-    std::vector<std::string> page_strings_;
+    // The previous page's buffer is kept alive so the pointer returned by the
+    // last next() stays valid until the following call.
+    ByteArrayBuffer page_values_;
+    ByteArrayBuffer prev_page_values_;
     std::vector<size_t> page_positions_;
     size_t string_idx_;
 
@@ -70,10 +165,14 @@ public:
     void reset();
 
 private:
+    void fill();
+
     ParquetReader& reader_;
     size_t start_;
     size_t end_;
     size_t current_;
+    size_t submitted_;  // pages read and queued for decompression
+    std::deque<std::future<std::vector<uint8_t>>> ahead_;
 };
 
 class ParquetReader {
@@ -82,6 +181,17 @@ public:
 
     bool open(const std::string& filename);
 
+    // Columns (names or dotted paths) the next open() prepares; empty, the
+    // default, means all. open() always parses the footer lazily: a chunk's
+    // ColumnMetaData stays undecoded in the retained footer until first used
+    // by a read, statistics or metadata(). A projection only limits which
+    // chunks get a ChunkTable row, a page index and their OffsetIndex/
+    // ColumnIndex at open, so the raw page API and prune_pages() cover the
+    // projected columns only. A projected open bypasses the metadata cache.
+    // open() fails if a projected column is not in the file.
+    void set_projection(std::vector<std::string> col_names) { projection_ = std::move(col_names); }
+    const std::vector<std::string>& projection() const { return projection_; }
+
     // ── Schema inspection ────────────────────────────────────────────────────
 
     size_t num_columns() const;
@@ -99,12 +209,141 @@ public:
     std::vector<Value> read_column(const std::string& col_name);
     std::vector<Value> read_column_by_idx(int row_group_idx, int col_idx);
 
+    // Same, decoding into a caller-owned vector whose capacity is kept
+    // across calls. The named overloads replace the contents of `out`;
+    // read_column_by_idx appends. All return the number of values written.
+    size_t read_column(const std::string& col_name, size_t row_group_idx, std::vector<Value>& out);
+    size_t read_column(const std::string& col_name, std::vector<Value>& out);
+    size_t read_column_by_idx(int row_group_idx, int col_idx, std::vector<Value>& out);
+
+    // INT96 columns read as epoch nanoseconds by default; enable to get the
+    // legacy "INT96(high:low)" strings from read_column() instead.
+    void set_int96_as_string(bool enabled);
+
+    // Decode strings returned by read_column() into `arena` (see
+    // ColumnReader::set_string_arena). The caller owns the arena and resets
+    // it once the values of a batch are no longer needed; nullptr restores
+    // owned std::string values.
+    void set_string_arena(StringArena* arena);
+
+    // Decoded dictionary pages are cached per (file path, size, mtime, row
+    // group, column) and shared by repeated reads and string iterators, so
+    // each is read and decoded once. Readers can share one cache; it is
+    // bounded by DictionaryCache::set_budget().
+    DictionaryCache& dictionary_cache();
+    void set_dictionary_cache(std::shared_ptr<DictionaryCache> cache);
+
+    // Share parsed footers and page indexes through `cache`: opening a file
+    // whose (path, size, mtime) is cached reads and parses no metadata.
+    // nullptr, the default, disables caching; MetadataCache::global() is
+    // one process-wide instance. Opens with a projection bypass the cache.
+    void set_metadata_cache(std::shared_ptr<MetadataCache> cache) { metadata_cache_ = std::move(cache); }
+    MetadataCache* metadata_cache() const { return metadata_cache_.get(); }
+
+    // Decompress pages for PageIterator and StringColumnIterator on
+    // `threads` worker threads, up to `depth` pages (default: two per
+    // thread) ahead of the consumer. Pages are still read by the calling
+    // thread and delivered in file order. 0 threads, the default,
+    // decompresses inline. Iterators already running stay valid; a
+    // StringColumnIterator finishes its row group on the pool it started with.
+    void set_decompression_threads(size_t threads, size_t depth = 0);
+    ThreadPool* decompression_pool() const { return decompression_pool_.get(); }
+    size_t prefetch_depth() const { return prefetch_depth_; }
+
+    // Verify the CRC32 of every page read (column reads, iterators, raw
+    // page data) against its page header; a mismatch throws. Pages
+    // written without a CRC are counted but not checked. Off by default.
+    void set_verify_checksums(bool verify) { verify_checksums_ = verify; }
+    bool verify_checksums() const { return verify_checksums_; }
+    const PageChecksums& checksum_stats() const { return *checksums_; }
+
+    // ── Typed column reading ─────────────────────────────────────────────────
+
+    ColumnVector read_column_vector(const std::string& col_name, size_t row_group_idx);
+    ColumnVector read_column_vector(const std::string& col_name);
+    size_t read_column_vector(const std::string& col_name, size_t row_group_idx, ColumnVector& out);
+    size_t read_column_vector(const std::string& col_name, ColumnVector& out);
+    size_t read_column_vector_by_idx(int row_group_idx, int col_idx, ColumnVector& out);
+
+    // Repeated (LIST / MAP) leaves assembled into per-level offsets plus
+    // leaf values. Nested leaves can be looked up by dotted path.
+    ListVector read_list_vector(const std::string& col_name, size_t row_group_idx);
+    ListVector read_list_vector(const std::string& col_name);
+    size_t read_list_vector_by_idx(int row_group_idx, int col_idx, ListVector& out);
+
     // ── String column iteration ─────────────────────────────────────────────
 
     StringColumnIterator column_iterator(const std::string& col_name);
 
+    // ── Statistics and pruning ───────────────────────────────────────────────
+
+    // Chunk statistics from the footer, decoded for the column's type;
+    // empty when the writer stored none.
+    ColumnStatistics column_statistics(const std::string& col_name, size_t row_group_idx) const;
+
+    // Indices of the row groups whose statistics do not rule out
+    // `predicate` on `col_name`, in file order; row groups without
+    // statistics are kept. For equality predicates the Bloom filters of the
+    // remaining row groups are probed as well; otherwise only the footer is
+    // consulted.
+    std::vector<size_t> prune_row_groups(const std::string& col_name,
+                                         const ColumnPredicate& predicate) const;
+
+    // Split-block Bloom filter of a column chunk, read from the file on
+    // each call; nullopt if none was written or it uses an unknown
+    // algorithm, hash or compression.
+    std::optional<BloomFilter> bloom_filter(const std::string& col_name,
+                                            size_t row_group_idx) const;
+
+    // ── Page index ───────────────────────────────────────────────────────────
+
+    // The OffsetIndex / ColumnIndex stored for a column chunk, or nullptr
+    // if the writer did not store one. Both are read once by open(), with
+    // one coalesced read per row group.
+    const OffsetIndex* offset_index(const std::string& col_name, size_t row_group_idx) const;
+    const ColumnIndex* column_index(const std::string& col_name, size_t row_group_idx) const;
+
+    // Global ids of the data pages of `col_name` that `predicate` may match,
+    // in file order: row groups are pruned by their chunk statistics, then
+    // pages by the ColumnIndex. Pages of chunks without a ColumnIndex are
+    // kept.
+    std::vector<size_t> prune_pages(const std::string& col_name,
+                                    const ColumnPredicate& predicate) const;
+
+    // ── Sorted lookups ───────────────────────────────────────────────────────
+
+    // Sort keys the writer declared for a row group, most significant first.
+    const std::vector<SortingColumn>& sorting_columns(size_t row_group_idx) const;
+
+    // The sort key of `col_name` if every row group lists it as its first
+    // sort key, in the same direction; nullopt otherwise.
+    std::optional<SortingColumn> sort_order(const std::string& col_name) const;
+
+    // Index of the first row whose value does not sort before `value` in
+    // the column's declared order, nulls first or last as declared, or the
+    // file's row count if there is none. The column must have a sort_order() and
+    // the row groups must follow it too. Row groups are binary-searched by
+    // their statistics, then pages by the chunk's ColumnIndex, and only the
+    // target page (and the dictionary) is decoded; chunks without a page
+    // index are decoded whole. A row group or page without min/max (none
+    // written, or all NaN) is read when the search probes it.
+    int64_t lower_bound(const std::string& col_name, const Value& value);
+
+    // ── Row lookups ──────────────────────────────────────────────────────────
+
+    // The page of projected column `col_name` holding file row `row`, found
+    // by binary search over the row groups' and then the chunk's pages'
+    // first rows; reads nothing. Repeated columns need an OffsetIndex.
+    RowLocation locate_row(const std::string& col_name, int64_t row) const;
+
+    // Value of a non-repeated column at file row `row`. Only the page
+    // locate_row() finds (and the chunk's dictionary) is decoded.
+    Value read_value(const std::string& col_name, int64_t row);
+
     // ── Raw page data API ────────────────────────────────────────────────────
 
+    // Page data is returned decompressed; PageIndexEntry::data_size is the
+    // stored (compressed) length and payload_size() the returned one.
     size_t num_pages() const;
     std::vector<uint8_t> read_page_data(size_t global_page_id) const;
     const PageIndexEntry& page_index_entry(size_t global_page_id) const;
@@ -115,24 +354,72 @@ public:
 
     // ── Accessors ────────────────────────────────────────────────────────────
 
+    // Decodes every ColumnMetaData not decoded yet first.
     const FileMetaData& metadata() const;
+    // ColumnMetaData of one column chunk (`col_idx` is ColumnInfo::column_index),
+    // decoded on first use; nullptr if the writer stored none.
+    const ColumnMetaData* column_chunk_meta(size_t row_group_idx, size_t col_idx) const;
+    // Offsets, sizes and value counts of every chunk of the projected
+    // columns, without decoding any ColumnMetaData.
+    const ChunkTable& chunk_table() const { return state_->chunks; }
     const std::vector<ColumnInfo>& columns() const;
     size_t file_size() const;
-    std::vector<uint8_t> read_range(size_t offset, size_t length);
+    // Thread-safe: reads of one reader are serialised on its file stream.
+    std::vector<uint8_t> read_range(size_t offset, size_t length) const;
 
 private:
-    void build_column_index();
-    void build_column_info();
-    void build_page_index();
-    void build_columns_recursive(int schema_idx, int schema_end,
+    friend class PageIterator;
+    friend class RecordBatchReader;
+    friend class StringColumnIterator;
+
+    void build_column_index(ParsedFile& file);
+    void build_column_info(ParsedFile& file);
+    void build_chunk_table(ParsedFile& file);
+    void build_page_index(ParsedFile& file);
+    bool is_projected(size_t col_idx) const {
+        return state_->projected.empty() || state_->projected[col_idx];
+    }
+    void read_chunk_indexes(ParsedFile& file, size_t row_group_idx);
+    void parse_page_header(PageIndexEntry& entry, const uint8_t* data, size_t size) const;
+    const PageIndexEntry& resolved_entry(size_t global_page_id) const;
+    const PageIndexEntry& store_resolved(size_t global_page_id, const PageIndexEntry& resolved) const;
+    void build_columns_recursive(ParsedFile& file, int schema_idx, int schema_end,
                                   int16_t def_level, int16_t rep_level,
+                                  std::vector<int16_t>& repeated_def_levels,
+                                  const std::string& path_prefix,
                                   int& col_index);
-    int skip_schema_subtree(int idx);
+    int skip_schema_subtree(const ParsedFile& file, int idx);
+    ColumnReader make_column_reader(int row_group_idx, int col_idx);
+    DictionaryCache::Key dictionary_key(int row_group_idx, int col_idx) const;  // file_mtime_ set
+    std::future<std::vector<uint8_t>> read_page_data_async(size_t global_page_id,
+                                                           ThreadPool* pool) const;
+    PageChecksums* page_checksums() const {
+        return verify_checksums_ ? checksums_.get() : nullptr;
+    }
 
-    std::ifstream file_;
+    // Seeked by every read, so guarded by file_mutex_ (reads are const)
+    mutable std::ifstream file_;
+    mutable std::mutex file_mutex_;
+    std::string path_;
     size_t file_size_ = 0;
-    FileMetaData metadata_;
-    std::vector<ColumnInfo> columns_;
-    std::unordered_map<std::string, size_t> column_name_to_idx_;
-    std::vector<PageIndexEntry> page_index_;
+    std::optional<int64_t> file_mtime_;  // unset when it can't be stat()ed
+    std::shared_ptr<const ParsedFile> state_ = std::make_shared<ParsedFile>();
+    std::vector<std::string> projection_;
+    // Index entries whose headers this reader resolved; the shared index is
+    // never written to. Filled by const page reads under resolve_mutex_;
+    // entries are only added, so references to them stay valid.
+    mutable std::unordered_map<size_t, PageIndexEntry> resolved_pages_;
+    mutable std::mutex resolve_mutex_;
+    std::shared_ptr<MetadataCache> metadata_cache_;
+    bool int96_as_string_ = false;
+    StringArena* string_arena_ = nullptr;
+    // Lent to the per-call ColumnReaders of read_column*() and lookups
+    DecodeScratch scratch_;
+    std::shared_ptr<DictionaryCache> dictionary_cache_ = std::make_shared<DictionaryCache>();
+    bool verify_checksums_ = false;
+    // Declared before the pool, whose destructor runs any still queued
+    // pipeline tasks, and those verify against it
+    std::unique_ptr<PageChecksums> checksums_ = std::make_unique<PageChecksums>();
+    std::shared_ptr<ThreadPool> decompression_pool_;  // shared with running pipelines
+    size_t prefetch_depth_ = 1;
 };
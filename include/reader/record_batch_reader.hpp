@@ -0,0 +1,76 @@
+#pragma once
+#include "column_reader.hpp"
+#include "column_vector.hpp"
+#include "parquet_reader.hpp"
+#include <optional>
+#include <string>
+#include <vector>
+
+// ── RecordBatch ────────────────────────────────────────────────────────────────
+
+// `num_rows` aligned rows of the projected columns: row i of the batch is
+// slot i of every entry in `columns`, which follow the projection order.
+// `fields` points at the reader's ColumnInfo for each column.
+struct RecordBatch {
+    std::vector<std::string> names;
+    std::vector<const ColumnInfo*> fields;
+    std::vector<ColumnVector> columns;
+    size_t num_rows = 0;
+
+    const ColumnVector& column(size_t i) const { return columns[i]; }
+};
+
+// ── RecordBatchReader ──────────────────────────────────────────────────────────
+
+// Reads a projection of non-repeated columns as aligned batches of
+// `batch_size` rows (the last batch may be shorter). Each column is decoded
+// a page at a time by its own ColumnReader; whenever several columns need
+// more rows, the page at the lowest file offset is read first, so I/O moves
+// through each row group in file order instead of column by column.
+// Batches may span row groups.
+class RecordBatchReader {
+public:
+    static constexpr size_t DEFAULT_BATCH_SIZE = 4096;
+
+    RecordBatchReader(ParquetReader& reader, const std::vector<std::string>& columns,
+                      size_t batch_size = DEFAULT_BATCH_SIZE);
+
+    // Fill `batch` with the next rows, reusing its buffers. Returns false
+    // (leaving `batch` empty) once all rows have been read.
+    bool next(RecordBatch& batch);
+
+    // Start over from the first row group.
+    void reset();
+
+    // Read only these row groups, in the given order (e.g. the result of
+    // ParquetReader::prune_row_groups()); the others are never opened.
+    // Restarts the reader.
+    void set_row_groups(std::vector<size_t> row_groups);
+
+    size_t batch_size() const { return batch_size_; }
+    int64_t rows_read() const { return rows_read_; }
+
+private:
+    struct ColumnState {
+        size_t col_idx;
+        size_t chunk = 0;       // position in row_groups_
+        std::optional<ColumnReader> reader;
+        ColumnVector pending;   // decoded rows not yet handed out
+        ColumnVector spare;     // compaction target, swapped with pending
+        size_t consumed = 0;    // rows of `pending` already handed out
+
+        size_t available() const { return pending.size - consumed; }
+    };
+
+    bool open_next_chunk(ColumnState& col);
+    void decode_page(ColumnState& col);
+
+    ParquetReader& reader_;
+    std::vector<std::string> names_;
+    std::vector<const ColumnInfo*> fields_;
+    std::vector<ColumnState> columns_;
+    std::vector<size_t> row_groups_;
+    int64_t total_rows_ = 0;
+    size_t batch_size_;
+    int64_t rows_read_ = 0;
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include "common.hpp"
+#include <algorithm>
 #include <cstring>
 #include <vector>
 
@@ -14,21 +15,28 @@ public:
           repeat_count_(0), literal_count_(0), current_value_(0),
           literal_pos_(nullptr), literal_bit_offset_(0) {}
 
+    // Decodes a whole run at a time: repeated runs are a fill, bit-packed
+    // runs are unpacked with one unaligned 64-bit load per value.
     template <typename T>
     void get_batch(T* out, uint32_t count) {
-        for (uint32_t i = 0; i < count; i++) {
+        uint32_t i = 0;
+        while (i < count) {
             if (repeat_count_ == 0 && literal_count_ == 0) {
                 if (!next_counts()) {
-                    for (; i < count; i++) out[i] = 0;
+                    std::fill(out + i, out + count, T(0));
                     return;
                 }
             }
             if (repeat_count_ > 0) {
-                out[i] = static_cast<T>(current_value_);
-                repeat_count_--;
+                uint32_t n = std::min(repeat_count_, count - i);
+                std::fill_n(out + i, n, static_cast<T>(current_value_));
+                repeat_count_ -= n;
+                i += n;
             } else {
-                out[i] = static_cast<T>(read_literal_value());
-                literal_count_--;
+                uint32_t n = std::min(literal_count_, count - i);
+                unpack_literals(out + i, n);
+                literal_count_ -= n;
+                i += n;
             }
         }
     }
@@ -38,12 +46,14 @@ private:
         if (pos_ >= size_) return false;
         uint32_t indicator = read_varint32();
         if (indicator & 1) {
-            // Literal (bit-packed) run
+            // Literal (bit-packed) run: groups of 8 values, bit_width bytes per group
             uint32_t literal_groups = indicator >> 1;
             literal_count_ = literal_groups * 8;
             literal_pos_ = data_ + pos_;
             literal_bit_offset_ = 0;
-            // Don't advance pos_ yet - we'll read bits from literal_pos_
+            uint64_t run_bytes = uint64_t(literal_groups) * bit_width_;
+            literal_end_ = run_bytes < size_ - pos_ ? pos_ + static_cast<uint32_t>(run_bytes) : size_;
+            pos_ = literal_end_;
         } else {
             // Repeated run
             repeat_count_ = indicator >> 1;
@@ -52,25 +62,27 @@ private:
         return true;
     }
 
-    uint64_t read_literal_value() {
-        if (bit_width_ == 0) return 0;
-        uint64_t val = 0;
-        for (uint8_t i = 0; i < bit_width_; i++) {
-            uint32_t byte_idx = literal_bit_offset_ / 8;
-            uint32_t bit_idx = literal_bit_offset_ % 8;
-            if (literal_pos_[byte_idx] & (1 << bit_idx)) {
-                val |= (uint64_t(1) << i);
-            }
-            literal_bit_offset_++;
+    template <typename T>
+    void unpack_literals(T* out, uint32_t n) {
+        if (bit_width_ == 0) {
+            std::fill_n(out, n, T(0));
+            return;
         }
-        // If we've exhausted all literals, advance pos_ past the bit-packed data
-        if (literal_count_ == 1) {
-            // This is the last literal value being read
-            uint32_t total_bits_consumed = literal_bit_offset_;
-            uint32_t bytes_consumed = (total_bits_consumed + 7) / 8;
-            pos_ = static_cast<uint32_t>(literal_pos_ - data_) + bytes_consumed;
+        const uint64_t mask = bit_width_ >= 64 ? ~uint64_t(0) : (uint64_t(1) << bit_width_) - 1;
+        const uint8_t* end = data_ + literal_end_;
+        uint64_t bit = literal_bit_offset_;
+        for (uint32_t i = 0; i < n; i++, bit += bit_width_) {
+            const uint8_t* p = literal_pos_ + bit / 8;
+            uint64_t word = 0;
+            if (p + 8 <= end) {
+                std::memcpy(&word, p, 8);
+            } else if (p < end) {
+                // Tail of the buffer (or a truncated final group)
+                std::memcpy(&word, p, static_cast<size_t>(end - p));
+            }
+            out[i] = static_cast<T>((word >> (bit % 8)) & mask);
         }
-        return val;
+        literal_bit_offset_ = static_cast<uint32_t>(bit);
     }
 
     uint32_t read_varint32() {
@@ -105,4 +117,5 @@ private:
     // Literal run state
     const uint8_t* literal_pos_;
     uint32_t literal_bit_offset_;
+    uint32_t literal_end_ = 0;  // end of the current bit-packed run in data_
 };
@@ -0,0 +1,70 @@
+#pragma once
+#include "column_info.hpp"
+#include "common.hpp"
+#include "metadata.hpp"
+#include <optional>
+
+// ── ColumnStatistics ───────────────────────────────────────────────────────────
+
+// Statistics of a column chunk or page with min/max decoded to the same
+// Value representation read_column() produces for the column (INT32 for
+// DATE, the raw bytes for BYTE_ARRAY / FIXED_LEN_BYTE_ARRAY, ...).
+struct ColumnStatistics {
+    std::optional<Value> min;
+    std::optional<Value> max;
+    std::optional<int64_t> null_count;
+    std::optional<int64_t> distinct_count;
+
+    bool has_min_max() const { return min.has_value() && max.has_value(); }
+};
+
+// Decode `raw` for column `col`. The min_value / max_value fields are used
+// when present. The deprecated min / max fields were written with signed
+// comparisons, so they are only trusted for types whose order is signed
+// (not for byte arrays or unsigned integers). INT96 and NaN bounds are
+// dropped.
+ColumnStatistics decode_statistics(const Statistics& raw, const ColumnInfo& col);
+
+// Statistics of page `page` from a chunk's ColumnIndex. Pages listed in
+// null_pages have no min/max.
+ColumnStatistics decode_page_statistics(const ColumnIndex& index, size_t page,
+                                        const ColumnInfo& col);
+
+// Order `a` and `b` (non-null values of column `col`) the way Parquet
+// statistics do: signed or unsigned integers per the converted type,
+// numeric decimals, unsigned lexicographic bytes. Integer and floating
+// values may be mixed. Returns <0, 0 or >0.
+int compare_values(const Value& a, const Value& b, const ColumnInfo& col);
+
+// ── ColumnPredicate ────────────────────────────────────────────────────────────
+
+// A filter on one column that statistics can rule out. RANGE matches the
+// non-null values within the optional bounds; nulls never match it.
+struct ColumnPredicate {
+    enum class Kind { RANGE, IS_NULL, IS_NOT_NULL };
+
+    Kind kind = Kind::RANGE;
+    std::optional<Value> lower;
+    bool lower_inclusive = true;
+    std::optional<Value> upper;
+    bool upper_inclusive = true;
+
+    static ColumnPredicate equal(Value v) { return between(v, v); }
+    static ColumnPredicate less(Value v) { return {Kind::RANGE, {}, true, std::move(v), false}; }
+    static ColumnPredicate less_equal(Value v) { return {Kind::RANGE, {}, true, std::move(v), true}; }
+    static ColumnPredicate greater(Value v) { return {Kind::RANGE, std::move(v), false, {}, true}; }
+    static ColumnPredicate greater_equal(Value v) { return {Kind::RANGE, std::move(v), true, {}, true}; }
+    static ColumnPredicate between(Value lo, Value hi) {
+        return {Kind::RANGE, std::move(lo), true, std::move(hi), true};
+    }
+    static ColumnPredicate is_null() { return {Kind::IS_NULL, {}, true, {}, true}; }
+    static ColumnPredicate is_not_null() { return {Kind::IS_NOT_NULL, {}, true, {}, true}; }
+
+    // True for a RANGE whose bounds are one inclusive value (equal()).
+    bool is_equality(const ColumnInfo& col) const;
+
+    // False only if no value of a chunk (or page) with `stats` and
+    // `num_values` values, nulls included, can satisfy the predicate.
+    bool might_match(const ColumnStatistics& stats, const ColumnInfo& col,
+                     int64_t num_values) const;
+};
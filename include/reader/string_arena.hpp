@@ -0,0 +1,97 @@
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// ── StringArena ────────────────────────────────────────────────────────────────
+//
+// Bump-pointer storage for decoded BYTE_ARRAY values. Strings are copied
+// into large blocks and handed out as string_views, so decoding a column of
+// short strings costs one allocation per block instead of one per value.
+// Views stay valid until reset() or destruction; reset() releases every
+// string at once and keeps the first block for the next batch.
+
+class StringArena {
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 1 << 20;
+
+    explicit StringArena(size_t block_size = DEFAULT_BLOCK_SIZE) : block_size_(block_size) {}
+
+    StringArena(const StringArena&) = delete;
+    StringArena& operator=(const StringArena&) = delete;
+
+    // The blocks move; the source is left empty, so its next copy() opens
+    // a block of its own instead of writing into the destination's
+    StringArena(StringArena&& other) noexcept
+        : block_size_(other.block_size_), blocks_(std::move(other.blocks_)),
+          cursor_(other.cursor_), remaining_(other.remaining_), used_(other.used_) {
+        other.release();
+    }
+
+    StringArena& operator=(StringArena&& other) noexcept {
+        if (this != &other) {
+            block_size_ = other.block_size_;
+            blocks_ = std::move(other.blocks_);
+            cursor_ = other.cursor_;
+            remaining_ = other.remaining_;
+            used_ = other.used_;
+            other.release();
+        }
+        return *this;
+    }
+
+    std::string_view copy(const char* data, size_t len) {
+        if (len > remaining_) grow(len);
+        char* dst = cursor_;
+        if (len > 0) std::memcpy(dst, data, len);
+        cursor_ += len;
+        remaining_ -= len;
+        used_ += len;
+        return {dst, len};
+    }
+
+    std::string_view copy(std::string_view s) { return copy(s.data(), s.size()); }
+
+    void reset() {
+        if (blocks_.size() > 1) blocks_.resize(1);
+        cursor_ = blocks_.empty() ? nullptr : blocks_[0].data.get();
+        remaining_ = blocks_.empty() ? 0 : blocks_[0].size;
+        used_ = 0;
+    }
+
+    size_t bytes_used() const { return used_; }
+    size_t bytes_reserved() const {
+        size_t total = 0;
+        for (const auto& b : blocks_) total += b.size;
+        return total;
+    }
+
+private:
+    struct Block {
+        std::unique_ptr<char[]> data;
+        size_t size;
+    };
+
+    void release() {
+        blocks_.clear();
+        cursor_ = nullptr;
+        remaining_ = 0;
+        used_ = 0;
+    }
+
+    void grow(size_t min_size) {
+        // Strings larger than a block get a block of their own
+        size_t size = min_size > block_size_ ? min_size : block_size_;
+        blocks_.push_back({std::unique_ptr<char[]>(new char[size]), size});
+        cursor_ = blocks_.back().data.get();
+        remaining_ = size;
+    }
+
+    size_t block_size_;
+    std::vector<Block> blocks_;
+    char* cursor_ = nullptr;
+    size_t remaining_ = 0;
+    size_t used_ = 0;
+};
@@ -1,10 +1,17 @@
 #pragma once
 #include "common.hpp"
-#include <stack>
 #include <string>
+#include <string_view>
 
+// Thrift compact protocol decoder over a caller-owned buffer. Decoding
+// allocates nothing itself: the field-id stack of enclosing structs is a
+// fixed inline array, views point into the buffer, and skip() steps over
+// values without materializing them.
 class ThriftReader {
 public:
+    // Deepest struct nesting accepted; deeper input throws.
+    static constexpr size_t MAX_DEPTH = 64;
+
     ThriftReader(const uint8_t* data, size_t size);
 
     struct FieldHeader {
@@ -22,6 +29,9 @@ public:
     double read_double();
     std::string read_string();
     std::string read_binary();
+    // Valid as long as the buffer the reader was constructed on.
+    std::string_view read_string_view();
+    std::string_view read_binary_view() { return read_string_view(); }
 
     struct ListHeader {
         uint8_t elem_type;
@@ -37,7 +47,10 @@ public:
     size_t remaining() const;
 
 private:
+    void skip(uint8_t type, size_t depth);
+
     ByteBuffer buf_;
     int16_t last_field_id_;
-    std::stack<int16_t> field_id_stack_;
+    size_t depth_ = 0;
+    int16_t field_id_stack_[MAX_DEPTH];
 };
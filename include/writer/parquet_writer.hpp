@@ -4,6 +4,7 @@
 #include <map>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -41,14 +42,19 @@ public:
     void close();
 
 private:
-    using ValueData = std::variant<bool, int32_t, int64_t, float, double, std::string>;
+    using ValueData = std::variant<bool, int32_t, int64_t, float, double, std::string_view>;
 
+    // Keys view the strings of the column analyze_column() was given, owned
+    // or arena-backed, so the result must not outlive that column.
     struct DictionaryResult {
         bool use_dictionary = false;
         std::vector<Value> dict_values;         // unique values, index = position
         std::map<ValueData, uint32_t> dict_map; // value data -> index
     };
 
+    // Dictionary key of a non-null value; strings are viewed, not copied.
+    static ValueData dict_key(const Value& v);
+
     struct PageBoundary {
         size_t offset;    // start index into the values vector
         size_t count;     // number of values in this page
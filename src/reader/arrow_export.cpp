@@ -0,0 +1,200 @@
+#include "reader/arrow_export.hpp"
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+// Stand-in for zero-length buffers, which must still be non-null pointers
+alignas(8) const uint8_t EMPTY_BUFFER[8] = {};
+
+const void* buffer_or_empty(const void* p, size_t bytes) {
+    return bytes == 0 ? EMPTY_BUFFER : p;
+}
+
+// ── Arrays ───────────────────────────────────────────────────────────────────
+
+// Owns everything an exported array points at; freed by release_array().
+struct ExportedArray {
+    ColumnVector vec;
+    std::vector<uint8_t> converted;   // packed booleans / widened decimals
+    const void* buffers[3] = {nullptr, nullptr, nullptr};
+    std::vector<ArrowArray*> children;
+
+    ~ExportedArray() {
+        for (ArrowArray* child : children) {
+            if (child->release) child->release(child);
+            delete child;
+        }
+    }
+};
+
+void release_array(ArrowArray* array) {
+    delete static_cast<ExportedArray*>(array->private_data);
+    array->release = nullptr;
+}
+
+void init_array(ArrowArray* out, ExportedArray* priv, int64_t length, int64_t null_count,
+                int64_t n_buffers) {
+    out->length = length;
+    out->null_count = null_count;
+    out->offset = 0;
+    out->n_buffers = n_buffers;
+    out->n_children = static_cast<int64_t>(priv->children.size());
+    out->buffers = priv->buffers;
+    out->children = priv->children.empty() ? nullptr : priv->children.data();
+    out->dictionary = nullptr;
+    out->release = &release_array;
+    out->private_data = priv;
+}
+
+// ── Schemas ──────────────────────────────────────────────────────────────────
+
+struct ExportedSchema {
+    std::string format;
+    std::string name;
+    std::vector<ArrowSchema*> children;
+
+    ~ExportedSchema() {
+        for (ArrowSchema* child : children) {
+            if (child->release) child->release(child);
+            delete child;
+        }
+    }
+};
+
+void release_schema(ArrowSchema* schema) {
+    delete static_cast<ExportedSchema*>(schema->private_data);
+    schema->release = nullptr;
+}
+
+void init_schema(ArrowSchema* out, ExportedSchema* priv, int64_t flags) {
+    out->format = priv->format.c_str();
+    out->name = priv->name.c_str();
+    out->metadata = nullptr;
+    out->flags = flags;
+    out->n_children = static_cast<int64_t>(priv->children.size());
+    out->children = priv->children.empty() ? nullptr : priv->children.data();
+    out->dictionary = nullptr;
+    out->release = &release_schema;
+    out->private_data = priv;
+}
+
+std::string decimal_format(const ColumnVector& vec) {
+    int32_t precision = vec.precision;
+    if (precision <= 0) precision = vec.type == VectorType::DECIMAL64 ? 18 : 38;
+    return "d:" + std::to_string(precision) + "," + std::to_string(vec.scale);
+}
+
+std::string arrow_format(const ColumnVector& vec, const ColumnInfo& info) {
+    switch (vec.type) {
+        case VectorType::BOOLEAN:      return "b";
+        case VectorType::INT32:        return "i";
+        case VectorType::INT64:        return "l";
+        case VectorType::FLOAT:        return "f";
+        case VectorType::DOUBLE:       return "g";
+        case VectorType::BYTE_ARRAY: {
+            auto ct = info.converted_type.value_or(ConvertedType::NONE);
+            bool utf8 = ct == ConvertedType::UTF8 || ct == ConvertedType::ENUM ||
+                        ct == ConvertedType::JSON;
+            return utf8 ? "u" : "z";
+        }
+        case VectorType::FIXED_BYTES:  return "w:" + std::to_string(vec.value_width);
+        case VectorType::DECIMAL64:
+        case VectorType::DECIMAL128:   return decimal_format(vec);
+        case VectorType::TIMESTAMP_NS: return "tsn:";
+    }
+    throw std::runtime_error("Unsupported vector type for Arrow export");
+}
+
+} // namespace
+
+// ── Public API ───────────────────────────────────────────────────────────────
+
+void export_arrow_array(ColumnVector&& vec, ArrowArray* out) {
+    auto priv = std::make_unique<ExportedArray>();
+    priv->vec = std::move(vec);
+    vec.clear();  // moved-from; left empty, keeping its type for schema export
+    ColumnVector& v = priv->vec;
+    size_t n = v.size;
+
+    priv->buffers[0] = (v.validity.empty() || v.null_count == 0) ? nullptr : v.validity.data();
+
+    int64_t n_buffers = 2;
+    switch (v.type) {
+        case VectorType::BOOLEAN: {
+            auto& bits = priv->converted;
+            bits.assign((n + 7) / 8, 0);
+            for (size_t i = 0; i < n; i++) {
+                bits[i / 8] |= static_cast<uint8_t>((v.data[i] != 0) << (i % 8));
+            }
+            priv->buffers[1] = buffer_or_empty(bits.data(), bits.size());
+            break;
+        }
+        case VectorType::DECIMAL64: {
+            auto& wide = priv->converted;
+            wide.resize(n * sizeof(__int128));
+            const int64_t* src = v.values<int64_t>();
+            for (size_t i = 0; i < n; i++) {
+                __int128 x = src[i];
+                std::memcpy(wide.data() + i * sizeof(__int128), &x, sizeof(__int128));
+            }
+            priv->buffers[1] = buffer_or_empty(wide.data(), wide.size());
+            break;
+        }
+        case VectorType::BYTE_ARRAY: {
+            if (v.strings.data.size() > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+                throw std::runtime_error("String column too large for 32-bit Arrow offsets");
+            }
+            // uint32 offsets below 2^31 are valid int32 offsets as they are
+            priv->buffers[1] = v.strings.offsets.data();
+            priv->buffers[2] = buffer_or_empty(v.strings.data.data(), v.strings.data.size());
+            n_buffers = 3;
+            break;
+        }
+        default:
+            priv->buffers[1] = buffer_or_empty(v.data.data(), v.data.size());
+            break;
+    }
+
+    int64_t null_count = static_cast<int64_t>(v.null_count);
+    init_array(out, priv.release(), static_cast<int64_t>(n), null_count, n_buffers);
+}
+
+void export_arrow_schema(const ColumnVector& vec, const ColumnInfo& info, ArrowSchema* out) {
+    auto priv = std::make_unique<ExportedSchema>();
+    priv->format = arrow_format(vec, info);
+    priv->name = info.path.empty() ? info.name : info.path;
+    int64_t flags = info.max_def_level > 0 ? ARROW_FLAG_NULLABLE : 0;
+    init_schema(out, priv.release(), flags);
+}
+
+void export_arrow_array(RecordBatch&& batch, ArrowArray* out) {
+    auto priv = std::make_unique<ExportedArray>();
+    priv->children.reserve(batch.columns.size());
+    for (auto& column : batch.columns) {
+        auto child = std::make_unique<ArrowArray>();
+        export_arrow_array(std::move(column), child.get());
+        priv->children.push_back(child.release());
+    }
+    int64_t length = static_cast<int64_t>(batch.num_rows);
+    batch.num_rows = 0;
+    init_array(out, priv.release(), length, 0, 1);
+}
+
+void export_arrow_schema(const RecordBatch& batch, ArrowSchema* out) {
+    if (batch.fields.size() != batch.columns.size()) {
+        throw std::runtime_error("RecordBatch has no field info for its columns");
+    }
+    auto priv = std::make_unique<ExportedSchema>();
+    priv->format = "+s";
+    priv->children.reserve(batch.columns.size());
+    for (size_t i = 0; i < batch.columns.size(); i++) {
+        auto child = std::make_unique<ArrowSchema>();
+        export_arrow_schema(batch.columns[i], *batch.fields[i], child.get());
+        priv->children.push_back(child.release());
+    }
+    init_schema(out, priv.release(), 0);
+}
@@ -0,0 +1,235 @@
+#include "reader/bloom_filter.hpp"
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define BLOOM_X86 1
+#include <immintrin.h>
+#endif
+
+// ── xxHash64 ─────────────────────────────────────────────────────────────────
+
+namespace {
+
+constexpr uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t rotl64(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+inline uint64_t load64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, 8);
+    return v;
+}
+
+inline uint32_t load32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, 4);
+    return v;
+}
+
+inline uint64_t round64(uint64_t acc, uint64_t input) {
+    acc += input * PRIME64_2;
+    acc = rotl64(acc, 31);
+    return acc * PRIME64_1;
+}
+
+inline uint64_t merge_round(uint64_t acc, uint64_t val) {
+    acc ^= round64(0, val);
+    return acc * PRIME64_1 + PRIME64_4;
+}
+
+} // namespace
+
+uint64_t xxhash64(const uint8_t* data, size_t size, uint64_t seed) {
+    const uint8_t* p = data;
+    const uint8_t* end = data + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        uint64_t v1 = seed + PRIME64_1 + PRIME64_2;
+        uint64_t v2 = seed + PRIME64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - PRIME64_1;
+        const uint8_t* limit = end - 32;
+        do {
+            v1 = round64(v1, load64(p));
+            v2 = round64(v2, load64(p + 8));
+            v3 = round64(v3, load64(p + 16));
+            v4 = round64(v4, load64(p + 24));
+            p += 32;
+        } while (p <= limit);
+        h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+        h = merge_round(h, v1);
+        h = merge_round(h, v2);
+        h = merge_round(h, v3);
+        h = merge_round(h, v4);
+    } else {
+        h = seed + PRIME64_5;
+    }
+    h += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= round64(0, load64(p));
+        h = rotl64(h, 27) * PRIME64_1 + PRIME64_4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(load32(p)) * PRIME64_1;
+        h = rotl64(h, 23) * PRIME64_2 + PRIME64_3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h ^= static_cast<uint64_t>(*p) * PRIME64_5;
+        h = rotl64(h, 11) * PRIME64_1;
+    }
+
+    h ^= h >> 33;
+    h *= PRIME64_2;
+    h ^= h >> 29;
+    h *= PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+// ── Block probe ──────────────────────────────────────────────────────────────
+
+namespace {
+
+alignas(32) const uint32_t SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                      0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+bool block_check_scalar(const uint8_t* block, uint32_t key) {
+    for (int i = 0; i < 8; i++) {
+        uint32_t mask = 1U << ((key * SALT[i]) >> 27);
+        if ((load32(block + 4 * i) & mask) == 0) return false;
+    }
+    return true;
+}
+
+#ifdef BLOOM_X86
+
+__attribute__((target("avx2")))
+bool block_check_avx2(const uint8_t* block, uint32_t key) {
+    __m256i salt = _mm256_load_si256(reinterpret_cast<const __m256i*>(SALT));
+    __m256i shift = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(key)), salt), 27);
+    __m256i mask = _mm256_sllv_epi32(_mm256_set1_epi32(1), shift);
+    __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    // All mask bits set in the block
+    return _mm256_testc_si256(words, mask) != 0;
+}
+
+bool has_avx2() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+#endif
+
+} // namespace
+
+// ── BloomFilter ──────────────────────────────────────────────────────────────
+
+BloomFilter::BloomFilter(std::vector<uint8_t> bitset)
+    : bitset_(std::move(bitset)), num_blocks_(bitset_.size() / BYTES_PER_BLOCK) {
+    if (bitset_.empty() || bitset_.size() % BYTES_PER_BLOCK != 0) {
+        throw std::runtime_error("Bloom filter size " + std::to_string(bitset_.size()) +
+                                 " is not a positive multiple of " +
+                                 std::to_string(BYTES_PER_BLOCK));
+    }
+}
+
+bool BloomFilter::might_contain_hash(uint64_t hash) const {
+    size_t block = static_cast<size_t>(((hash >> 32) * num_blocks_) >> 32);
+    const uint8_t* p = bitset_.data() + block * BYTES_PER_BLOCK;
+    uint32_t key = static_cast<uint32_t>(hash);
+#ifdef BLOOM_X86
+    if (has_avx2()) return block_check_avx2(p, key);
+#endif
+    return block_check_scalar(p, key);
+}
+
+bool BloomFilter::might_contain(const Value& value, const ColumnInfo& col) const {
+    auto h = hash(value, col);
+    return !h || might_contain_hash(*h);
+}
+
+namespace {
+
+template <typename T>
+uint64_t hash_plain(T v) {
+    uint8_t bytes[sizeof(T)];
+    std::memcpy(bytes, &v, sizeof(T));
+    return xxhash64(bytes, sizeof(T));
+}
+
+// Integer literal of `value` if it has one
+std::optional<int64_t> integer_of(const Value& value) {
+    if (auto* v = std::get_if<int32_t>(&value.data)) return *v;
+    if (auto* v = std::get_if<int64_t>(&value.data)) return *v;
+    if (auto* v = std::get_if<double>(&value.data)) {
+        if (std::nearbyint(*v) == *v && std::fabs(*v) < 9.2e18) return static_cast<int64_t>(*v);
+    }
+    if (auto* v = std::get_if<float>(&value.data)) {
+        if (std::nearbyint(*v) == *v && std::fabs(*v) < 9.2e18f) return static_cast<int64_t>(*v);
+    }
+    return std::nullopt;
+}
+
+std::optional<double> floating_of(const Value& value) {
+    return std::visit([](auto&& x) -> std::optional<double> {
+        using T = std::decay_t<decltype(x)>;
+        if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) return static_cast<double>(x);
+        else return std::nullopt;
+    }, value.data);
+}
+
+} // namespace
+
+std::optional<uint64_t> BloomFilter::hash(const Value& value, const ColumnInfo& col) {
+    if (value.is_null) return std::nullopt;
+    switch (col.type) {
+        case ParquetType::INT32: {
+            auto v = integer_of(value);
+            if (!v) return std::nullopt;
+            // UINT_32 values above INT32_MAX are stored as their bit pattern
+            if (*v < std::numeric_limits<int32_t>::min() || *v > std::numeric_limits<uint32_t>::max()) {
+                return std::nullopt;
+            }
+            return hash_plain(static_cast<int32_t>(static_cast<uint32_t>(*v)));
+        }
+        case ParquetType::INT64: {
+            auto v = integer_of(value);
+            if (!v) return std::nullopt;
+            return hash_plain(*v);
+        }
+        // -0.0 equals 0.0 but hashes differently
+        case ParquetType::FLOAT: {
+            auto v = floating_of(value);
+            if (!v || *v == 0 || static_cast<double>(static_cast<float>(*v)) != *v) return std::nullopt;
+            return hash_plain(static_cast<float>(*v));
+        }
+        case ParquetType::DOUBLE: {
+            auto v = floating_of(value);
+            if (!v || *v == 0) return std::nullopt;
+            return hash_plain(*v);
+        }
+        case ParquetType::BYTE_ARRAY:
+        case ParquetType::FIXED_LEN_BYTE_ARRAY: {
+            // Decimals compare numerically, but hash their exact bytes
+            if (col.is_decimal() || (!std::holds_alternative<std::string>(value.data) &&
+                                     !std::holds_alternative<std::string_view>(value.data))) {
+                return std::nullopt;
+            }
+            std::string_view s = value.str();
+            return xxhash64(reinterpret_cast<const uint8_t*>(s.data()), s.size());
+        }
+        default:
+            return std::nullopt;
+    }
+}
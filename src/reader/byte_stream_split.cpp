@@ -0,0 +1,189 @@
+#include "reader/byte_stream_split.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define BSS_X86 1
+#include <immintrin.h>
+#endif
+
+// ── Scalar ───────────────────────────────────────────────────────────────────
+
+template <size_t W>
+static void decode_scalar_fixed(const uint8_t* src, size_t stride, size_t count,
+                                uint8_t* out) {
+    for (size_t i = 0; i < count; i++) {
+        for (size_t k = 0; k < W; k++) {
+            out[i * W + k] = src[k * stride + i];
+        }
+    }
+}
+
+void byte_stream_split_decode_scalar(const uint8_t* src, size_t stride, size_t width,
+                                     size_t count, uint8_t* out) {
+    switch (width) {
+        case 4: decode_scalar_fixed<4>(src, stride, count, out); return;
+        case 8: decode_scalar_fixed<8>(src, stride, count, out); return;
+        default:
+            for (size_t i = 0; i < count; i++) {
+                for (size_t k = 0; k < width; k++) {
+                    out[i * width + k] = src[k * stride + i];
+                }
+            }
+    }
+}
+
+#ifdef BSS_X86
+
+// ── SSE2 (x86-64 baseline) ───────────────────────────────────────────────────
+
+// 16 values per iteration: two rounds of byte/word unpacks turn four byte
+// streams into sixteen 4-byte values.
+__attribute__((target("sse2")))
+static size_t decode4_sse2(const uint8_t* src, size_t stride, size_t count, uint8_t* out) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i s0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i s1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + stride + i));
+        __m128i s2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * stride + i));
+        __m128i s3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 3 * stride + i));
+
+        __m128i a = _mm_unpacklo_epi8(s0, s1);
+        __m128i b = _mm_unpackhi_epi8(s0, s1);
+        __m128i c = _mm_unpacklo_epi8(s2, s3);
+        __m128i d = _mm_unpackhi_epi8(s2, s3);
+
+        __m128i* dst = reinterpret_cast<__m128i*>(out + i * 4);
+        _mm_storeu_si128(dst + 0, _mm_unpacklo_epi16(a, c));
+        _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(a, c));
+        _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(b, d));
+        _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(b, d));
+    }
+    return i;
+}
+
+// 16 values per iteration: byte, word and dword unpacks turn eight byte
+// streams into sixteen 8-byte values.
+__attribute__((target("sse2")))
+static size_t decode8_sse2(const uint8_t* src, size_t stride, size_t count, uint8_t* out) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i s[8];
+        for (int k = 0; k < 8; k++) {
+            s[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + k * stride + i));
+        }
+        // Byte pairs (0,1) (2,3) (4,5) (6,7); lo = values 0-7, hi = values 8-15
+        __m128i p_lo[4], p_hi[4];
+        for (int k = 0; k < 4; k++) {
+            p_lo[k] = _mm_unpacklo_epi8(s[2 * k], s[2 * k + 1]);
+            p_hi[k] = _mm_unpackhi_epi8(s[2 * k], s[2 * k + 1]);
+        }
+        // Bytes 0-3 and 4-7 of four values each
+        __m128i q[4] = {
+            _mm_unpacklo_epi16(p_lo[0], p_lo[1]), _mm_unpackhi_epi16(p_lo[0], p_lo[1]),
+            _mm_unpacklo_epi16(p_hi[0], p_hi[1]), _mm_unpackhi_epi16(p_hi[0], p_hi[1]),
+        };
+        __m128i r[4] = {
+            _mm_unpacklo_epi16(p_lo[2], p_lo[3]), _mm_unpackhi_epi16(p_lo[2], p_lo[3]),
+            _mm_unpacklo_epi16(p_hi[2], p_hi[3]), _mm_unpackhi_epi16(p_hi[2], p_hi[3]),
+        };
+        __m128i* dst = reinterpret_cast<__m128i*>(out + i * 8);
+        for (int k = 0; k < 4; k++) {
+            _mm_storeu_si128(dst + 2 * k, _mm_unpacklo_epi32(q[k], r[k]));
+            _mm_storeu_si128(dst + 2 * k + 1, _mm_unpackhi_epi32(q[k], r[k]));
+        }
+    }
+    return i;
+}
+
+// ── AVX2 ─────────────────────────────────────────────────────────────────────
+
+// Same shuffles as SSE2 on 32 values at a time. AVX2 unpacks work per 128-bit
+// lane, so the final lane halves are recombined with permute2x128.
+__attribute__((target("avx2")))
+static size_t decode4_avx2(const uint8_t* src, size_t stride, size_t count, uint8_t* out) {
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i s0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i s1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + stride + i));
+        __m256i s2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 2 * stride + i));
+        __m256i s3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 3 * stride + i));
+
+        __m256i a = _mm256_unpacklo_epi8(s0, s1);
+        __m256i b = _mm256_unpackhi_epi8(s0, s1);
+        __m256i c = _mm256_unpacklo_epi8(s2, s3);
+        __m256i d = _mm256_unpackhi_epi8(s2, s3);
+
+        // Lane 0 holds values 0-15, lane 1 values 16-31
+        __m256i e = _mm256_unpacklo_epi16(a, c);
+        __m256i f = _mm256_unpackhi_epi16(a, c);
+        __m256i g = _mm256_unpacklo_epi16(b, d);
+        __m256i h = _mm256_unpackhi_epi16(b, d);
+
+        __m256i* dst = reinterpret_cast<__m256i*>(out + i * 4);
+        _mm256_storeu_si256(dst + 0, _mm256_permute2x128_si256(e, f, 0x20));
+        _mm256_storeu_si256(dst + 1, _mm256_permute2x128_si256(g, h, 0x20));
+        _mm256_storeu_si256(dst + 2, _mm256_permute2x128_si256(e, f, 0x31));
+        _mm256_storeu_si256(dst + 3, _mm256_permute2x128_si256(g, h, 0x31));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+static size_t decode8_avx2(const uint8_t* src, size_t stride, size_t count, uint8_t* out) {
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i s[8];
+        for (int k = 0; k < 8; k++) {
+            s[k] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + k * stride + i));
+        }
+        __m256i p_lo[4], p_hi[4];
+        for (int k = 0; k < 4; k++) {
+            p_lo[k] = _mm256_unpacklo_epi8(s[2 * k], s[2 * k + 1]);
+            p_hi[k] = _mm256_unpackhi_epi8(s[2 * k], s[2 * k + 1]);
+        }
+        __m256i q[4] = {
+            _mm256_unpacklo_epi16(p_lo[0], p_lo[1]), _mm256_unpackhi_epi16(p_lo[0], p_lo[1]),
+            _mm256_unpacklo_epi16(p_hi[0], p_hi[1]), _mm256_unpackhi_epi16(p_hi[0], p_hi[1]),
+        };
+        __m256i r[4] = {
+            _mm256_unpacklo_epi16(p_lo[2], p_lo[3]), _mm256_unpackhi_epi16(p_lo[2], p_lo[3]),
+            _mm256_unpacklo_epi16(p_hi[2], p_hi[3]), _mm256_unpackhi_epi16(p_hi[2], p_hi[3]),
+        };
+        // Each vector: two values per lane; lane 0 covers values 0-15, lane 1 16-31
+        __m256i v[8];
+        for (int k = 0; k < 4; k++) {
+            v[2 * k] = _mm256_unpacklo_epi32(q[k], r[k]);
+            v[2 * k + 1] = _mm256_unpackhi_epi32(q[k], r[k]);
+        }
+        __m256i* dst = reinterpret_cast<__m256i*>(out + i * 8);
+        for (int k = 0; k < 4; k++) {
+            _mm256_storeu_si256(dst + k, _mm256_permute2x128_si256(v[2 * k], v[2 * k + 1], 0x20));
+            _mm256_storeu_si256(dst + 4 + k, _mm256_permute2x128_si256(v[2 * k], v[2 * k + 1], 0x31));
+        }
+    }
+    return i;
+}
+
+static bool has_avx2() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+#endif // BSS_X86
+
+// ── Dispatch ─────────────────────────────────────────────────────────────────
+
+void byte_stream_split_decode(const uint8_t* src, size_t stride, size_t width,
+                              size_t count, uint8_t* out) {
+    size_t done = 0;
+#ifdef BSS_X86
+    if (width == 4) {
+        done = has_avx2() ? decode4_avx2(src, stride, count, out)
+                          : decode4_sse2(src, stride, count, out);
+    } else if (width == 8) {
+        done = has_avx2() ? decode8_avx2(src, stride, count, out)
+                          : decode8_sse2(src, stride, count, out);
+    }
+#endif
+    byte_stream_split_decode_scalar(src + done, stride, width, count - done,
+                                    out + done * width);
+}
@@ -20,3 +20,7 @@ bool ColumnInfo::is_optional() const {
 bool ColumnInfo::is_repeated() const {
     return repetition.has_value() && repetition.value() == FieldRepetitionType::REPEATED;
 }
+
+bool ColumnInfo::is_decimal() const {
+    return converted_type.has_value() && converted_type.value() == ConvertedType::DECIMAL;
+}
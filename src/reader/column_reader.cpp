@@ -1,128 +1,209 @@
 #include "reader/column_reader.hpp"
 
+namespace {
+
+// DATA_PAGE_V2 pages are indexed, and read_page_data() returns their bytes,
+// but they are not decoded into values
+[[noreturn]] void data_page_v2_unsupported(size_t offset) {
+    throw std::runtime_error("DATA_PAGE_V2 page at offset " + std::to_string(offset) +
+                             " cannot be decoded");
+}
+
+} // namespace
+
 ColumnReader::ColumnReader(ReadRangeFunc read_range,
                            const ColumnChunk& chunk, ParquetType type,
                            int16_t max_def_level, int16_t max_rep_level)
     : read_range_(std::move(read_range)),
       type_(type), max_def_level_(max_def_level), max_rep_level_(max_rep_level) {
 
-    if (!chunk.meta_data.has_value()) {
+    if (!chunk.meta_data) {
         throw std::runtime_error("ColumnChunk has no metadata");
     }
-    meta_ = &chunk.meta_data.value();
-    if (meta_->codec != CompressionCodec::UNCOMPRESSED) {
-        throw std::runtime_error("Only uncompressed parquet files are supported");
-    }
+    meta_ = chunk.meta_data.get();
+    decompressor_ = PageDecompressor(meta_->codec);
+    rewind();
+}
+
+ColumnReader::ColumnReader(ReadRangeFunc read_range,
+                           const ColumnChunk& chunk, const ColumnInfo& info)
+    : ColumnReader(std::move(read_range), chunk, info.type,
+                   info.max_def_level, info.max_rep_level) {
+    type_length_ = info.type_length.value_or(0);
+    repeated_def_levels_ = info.repeated_def_levels;
+    is_decimal_ = info.is_decimal();
+    scale_ = info.scale.value_or(0);
+    precision_ = info.precision.value_or(0);
 }
 
 std::vector<Value> ColumnReader::read_all() {
     std::vector<Value> result;
+    read_all(result);
+    return result;
+}
 
-    // Determine starting offset
-    int64_t offset = meta_->data_page_offset;
-    if (meta_->dictionary_page_offset.has_value()) {
-        offset = std::min(offset, *meta_->dictionary_page_offset);
-    }
-
-    size_t cur_offset = static_cast<size_t>(offset);
-    int64_t values_read = 0;
-    bool has_dict = false;
-    std::vector<Value> dictionary;
-
-    while (values_read < meta_->num_values) {
-        // Read a small chunk for the page header (Thrift-encoded, typically < 256 bytes)
-        static constexpr size_t HEADER_READ_SIZE = 256;
-        auto header_buf = read_range_(cur_offset, HEADER_READ_SIZE);
-        ThriftReader header_reader(header_buf.data(), header_buf.size());
-        PageHeader page_header;
-        page_header.deserialize(header_reader);
-        size_t header_size = header_reader.position();
-        cur_offset += header_size;
+size_t ColumnReader::read_all(std::vector<Value>& out) {
+    size_t start = out.size();
+    DictionaryCache::Values dictionary;
 
-        int32_t page_size = page_header.compressed_page_size;
+    for (const auto& page : page_headers()) {
+        if (page.type == PageType::DICTIONARY_PAGE) {
+            dictionary = load_dictionary(page.data_offset(), page.header());
+        } else if (page.type == PageType::DATA_PAGE) {
+            PageHeader page_header = page.header();
+            auto& dph = page_header.data_page_header.value();
+            PageSpan payload = read_page_payload(page.data_offset(), page_header);
+            read_data_page(payload.data, static_cast<int32_t>(payload.size), dph, dictionary.get(), out);
+        } else if (page.type == PageType::DATA_PAGE_V2) {
+            data_page_v2_unsupported(page.offset);
+        }
+        // Skip unknown page types
+    }
 
-        // Read the page payload
-        auto page_buf = read_range_(cur_offset, static_cast<size_t>(page_size));
-        const uint8_t* page_data = page_buf.data();
+    return out.size() - start;
+}
 
-        if (page_header.type == PageType::DICTIONARY_PAGE) {
-            dictionary = read_dictionary_page(page_data, page_size,
-                page_header.dictionary_page_header.value());
-            has_dict = true;
-            cur_offset += page_size;
-            continue;
+size_t ColumnReader::read_page_at(size_t page_offset, std::vector<Value>& out) {
+    // Headers another walk recorded are used; otherwise only the two
+    // headers needed are decoded rather than walking the whole chunk.
+    if (!headers_ && header_cache_) headers_ = header_cache_->find(header_key_);
+    auto read_header = [this](size_t offset) {
+        if (headers_) {
+            auto it = std::lower_bound(headers_->begin(), headers_->end(), offset,
+                [](const CachedPageHeader& page, size_t off) { return page.offset < off; });
+            if (it != headers_->end() && it->offset == offset) return *it;
         }
-
-        if (page_header.type == PageType::DATA_PAGE) {
-            auto& dph = page_header.data_page_header.value();
-            auto page_values = read_data_page(page_data, page_size, dph,
-                has_dict ? &dictionary : nullptr);
-            result.insert(result.end(), page_values.begin(), page_values.end());
-            values_read += dph.num_values;
-            cur_offset += page_size;
-            continue;
+        auto header_buf = read_range_(offset, HEADER_READ_SIZE);
+        ThriftReader header_reader(header_buf.data(), header_buf.size());
+        PageHeader header;
+        header.deserialize(header_reader, /*skip_statistics=*/true);
+        return CachedPageHeader::from(header, offset, header_reader.position());
+    };
+
+    size_t chunk_start = first_page_offset();
+    DictionaryCache::Values dictionary;
+    if (chunk_start < page_offset) {
+        CachedPageHeader dict_header = read_header(chunk_start);
+        if (dict_header.type == PageType::DICTIONARY_PAGE) {
+            dictionary = load_dictionary(dict_header.data_offset(), dict_header.header());
         }
-
-        // Skip unknown page types
-        cur_offset += page_size;
     }
 
-    return result;
+    CachedPageHeader page = read_header(page_offset);
+    PageHeader page_header = page.header();
+    if (page_header.type != PageType::DATA_PAGE || !page_header.data_page_header) {
+        throw std::runtime_error("No data page at offset " + std::to_string(page_offset));
+    }
+    size_t start = out.size();
+    PageSpan payload = read_page_payload(page.data_offset(), page_header);
+    read_data_page(payload.data, static_cast<int32_t>(payload.size), *page_header.data_page_header,
+                   dictionary.get(), out);
+    return out.size() - start;
 }
 
 std::vector<PageResult> ColumnReader::read_pages() {
     std::vector<PageResult> pages;
+    read_pages(pages);
+    return pages;
+}
 
-    int64_t offset = meta_->data_page_offset;
-    if (meta_->dictionary_page_offset.has_value()) {
-        offset = std::min(offset, *meta_->dictionary_page_offset);
-    }
-
-    size_t cur_offset = static_cast<size_t>(offset);
-    int64_t values_read = 0;
-    bool has_dict = false;
-    std::vector<Value> dictionary;
+size_t ColumnReader::read_pages(std::vector<PageResult>& pages) {
+    // Entries already in `pages` are overwritten in place so their value
+    // vectors keep their capacity; surplus entries are dropped at the end.
+    size_t num_pages = 0;
+    size_t total_values = 0;
+    auto next_page = [&pages, &num_pages]() -> PageResult& {
+        if (num_pages == pages.size()) pages.emplace_back();
+        PageResult& page = pages[num_pages++];
+        page.values.clear();
+        return page;
+    };
+
+    DictionaryCache::Values dictionary;
     int page_num = 0;
 
-    while (values_read < meta_->num_values) {
-        static constexpr size_t HEADER_READ_SIZE = 256;
-        auto header_buf = read_range_(cur_offset, HEADER_READ_SIZE);
-        ThriftReader header_reader(header_buf.data(), header_buf.size());
-        PageHeader page_header;
-        page_header.deserialize(header_reader);
-        cur_offset += header_reader.position();
-
-        int32_t page_size = page_header.compressed_page_size;
-
-        auto page_buf = read_range_(cur_offset, static_cast<size_t>(page_size));
-        const uint8_t* page_data = page_buf.data();
-
-        if (page_header.type == PageType::DICTIONARY_PAGE) {
-            dictionary = read_dictionary_page(page_data, page_size,
-                page_header.dictionary_page_header.value());
-            has_dict = true;
-            pages.push_back({page_num++, PageType::DICTIONARY_PAGE,
-                page_header.dictionary_page_header->num_values, {}});
-            cur_offset += page_size;
+    for (const auto& header : page_headers()) {
+        if (header.type == PageType::DICTIONARY_PAGE) {
+            PageHeader page_header = header.header();
+            dictionary = load_dictionary(header.data_offset(), page_header);
+            PageResult& page = next_page();
+            page.page_num = page_num++;
+            page.type = PageType::DICTIONARY_PAGE;
+            page.num_values = page_header.dictionary_page_header->num_values;
             continue;
         }
 
-        if (page_header.type == PageType::DATA_PAGE) {
+        if (header.type == PageType::DATA_PAGE) {
+            PageHeader page_header = header.header();
             auto& dph = page_header.data_page_header.value();
-            auto page_values = read_data_page(page_data, page_size, dph,
-                has_dict ? &dictionary : nullptr);
-            values_read += dph.num_values;
-            pages.push_back({page_num++, PageType::DATA_PAGE,
-                dph.num_values, std::move(page_values)});
-            cur_offset += page_size;
+            PageSpan payload = read_page_payload(header.data_offset(), page_header);
+            PageResult& page = next_page();
+            page.page_num = page_num++;
+            page.type = PageType::DATA_PAGE;
+            page.num_values = dph.num_values;
+            read_data_page(payload.data, static_cast<int32_t>(payload.size), dph, dictionary.get(),
+                           page.values);
+            total_values += page.values.size();
             continue;
         }
+        if (header.type == PageType::DATA_PAGE_V2) data_page_v2_unsupported(header.offset);
 
-        cur_offset += page_size;
         page_num++;
     }
 
-    return pages;
+    pages.resize(num_pages);
+    return total_values;
+}
+
+// The chunk's dictionary for the Value API: shared from the cache when
+// another scan already decoded it, otherwise read, decoded and cached.
+// Cached strings are owned; with a string arena they are copied into it
+// once here so expanded values are views rather than string copies.
+DictionaryCache::Values ColumnReader::load_dictionary(size_t offset, const PageHeader& header) {
+    // INT96 entries decode to nanoseconds or strings per reader setting
+    DictionaryCache::Key key = dict_key_;
+    key.int96_as_string = type_ == ParquetType::INT96 && int96_as_string_;
+    DictionaryCache::Values dict;
+    if (dict_cache_) dict = dict_cache_->find_values(key);
+    if (!dict) {
+        PageSpan page = read_page_payload(offset, header);
+        auto decoded = read_dictionary_page(page.data, static_cast<int32_t>(page.size),
+                                            header.dictionary_page_header.value());
+        dict = dict_cache_ ? dict_cache_->store_values(key, std::move(decoded))
+                           : std::make_shared<const std::vector<Value>>(std::move(decoded));
+    }
+    if (string_arena_ &&
+        (type_ == ParquetType::BYTE_ARRAY || type_ == ParquetType::FIXED_LEN_BYTE_ARRAY)) {
+        std::vector<Value> views;
+        views.reserve(dict->size());
+        for (const Value& v : *dict) views.push_back(make_string(v.str(), string_arena_));
+        dict = std::make_shared<const std::vector<Value>>(std::move(views));
+    }
+    return dict;
+}
+
+DictionaryCache::Vector ColumnReader::load_dictionary_vector(size_t offset,
+                                                             const PageHeader& header) {
+    if (dict_cache_) {
+        if (auto dict = dict_cache_->find_vector(dict_key_)) return dict;
+    }
+    PageSpan page = read_page_payload(offset, header);
+    ColumnVector decoded;
+    read_dictionary_page(page.data, static_cast<int32_t>(page.size),
+                         header.dictionary_page_header.value(), decoded);
+    if (dict_cache_) return dict_cache_->store_vector(dict_key_, std::move(decoded));
+    return std::make_shared<const ColumnVector>(std::move(decoded));
+}
+
+// Read the stored payload of the page whose header ends at `offset` and
+// return its uncompressed bytes, valid until the next call.
+PageSpan ColumnReader::read_page_payload(size_t offset, const PageHeader& header) {
+    DecodeScratch& s = scratch();
+    s.page_stored = read_range_(offset, static_cast<size_t>(header.compressed_page_size));
+    if (checksums_) checksums_->verify(header.crc, s.page_stored.data(), s.page_stored.size());
+    return decompressor_.decompress(s.page_stored.data(), s.page_stored.size(),
+                                    static_cast<size_t>(header.uncompressed_page_size),
+                                    s.decompressed);
 }
 
 std::vector<Value> ColumnReader::read_dictionary_page(const uint8_t* data, int32_t size,
@@ -132,19 +213,33 @@ std::vector<Value> ColumnReader::read_dictionary_page(const uint8_t* data, int32
     ByteBuffer buf(data, size);
 
     for (int32_t i = 0; i < header.num_values; i++) {
-        dict.push_back(read_plain_value(buf));
+        dict.push_back(read_plain_value(buf, nullptr));
     }
     return dict;
 }
 
-std::vector<Value> ColumnReader::read_data_page(const uint8_t* data, int32_t size,
-                                                 const DataPageHeader& header,
-                                                 const std::vector<Value>* dictionary) {
+// Decode one data page, appending its values to `out`.
+void ColumnReader::read_data_page(const uint8_t* data, int32_t size,
+                                  const DataPageHeader& header,
+                                  const std::vector<Value>* dictionary,
+                                  std::vector<Value>& out) {
     ByteBuffer buf(data, size);
     int32_t num_values = header.num_values;
 
+    // Read repetition levels (they precede definition levels in a v1 data page)
+    std::vector<int16_t>& rep_levels = scratch().rep_levels;
+    rep_levels.assign(num_values, 0);
+    if (max_rep_level_ > 0) {
+        uint32_t rep_len = buf.read<uint32_t>();
+        RleDecoder rep_decoder(buf.current(), rep_len,
+            bit_width(max_rep_level_));
+        rep_decoder.get_batch(rep_levels.data(), num_values);
+        buf.read_bytes(rep_len);
+    }
+
     // Read definition levels
-    std::vector<int16_t> def_levels(num_values, max_def_level_);
+    std::vector<int16_t>& def_levels = scratch().def_levels;
+    def_levels.assign(num_values, max_def_level_);
     if (max_def_level_ > 0) {
         uint32_t def_len = buf.read<uint32_t>();
         RleDecoder def_decoder(buf.current(), def_len,
@@ -153,16 +248,6 @@ std::vector<Value> ColumnReader::read_data_page(const uint8_t* data, int32_t siz
         buf.read_bytes(def_len);
     }
 
-    // Read repetition levels
-    std::vector<int16_t> rep_levels(num_values, 0);
-    if (max_rep_level_ > 0) {
-        uint32_t rep_len = buf.read<uint32_t>();
-        RleDecoder rep_decoder(buf.current(), rep_len,
-            bit_width(max_rep_level_));
-        rep_decoder.get_batch(rep_levels.data(), num_values);
-        buf.read_bytes(rep_len);
-    }
-
     // Count non-null values
     int32_t num_non_null = 0;
     for (int32_t i = 0; i < num_values; i++) {
@@ -170,7 +255,12 @@ std::vector<Value> ColumnReader::read_data_page(const uint8_t* data, int32_t siz
     }
 
     // Decode values
-    std::vector<Value> values;
+    if (PageKernel kernel = select_page_kernel(type_, header.encoding, max_def_level_ == 0)) {
+        kernel(buf, def_levels.data(), max_def_level_, static_cast<size_t>(num_values),
+               static_cast<size_t>(num_non_null), out, string_arena_);
+        return;
+    }
+
     bool use_dict = (header.encoding == Encoding::PLAIN_DICTIONARY ||
                      header.encoding == Encoding::RLE_DICTIONARY);
 
@@ -178,53 +268,88 @@ std::vector<Value> ColumnReader::read_data_page(const uint8_t* data, int32_t siz
         // RLE-encoded dictionary indices with 1-byte bit-width prefix
         uint8_t bw = buf.read_byte();
         RleDecoder idx_decoder(buf.current(), static_cast<uint32_t>(buf.remaining()), bw);
-        std::vector<int32_t> indices(num_non_null);
+        std::vector<uint32_t>& indices = scratch().indices;
+        indices.resize(num_non_null);
         idx_decoder.get_batch(indices.data(), num_non_null);
 
-        int32_t idx_pos = 0;
+        if (num_non_null > 0) {
+            uint32_t max_idx = max_dictionary_index(indices.data(), indices.size());
+            if (max_idx >= dictionary->size()) {
+                throw std::runtime_error("Dictionary index " + std::to_string(max_idx) +
+                    " out of range (dictionary size " + std::to_string(dictionary->size()) + ")");
+            }
+        }
+        auto gather = max_def_level_ == 0 ? &gather_dictionary_values<true>
+                                          : &gather_dictionary_values<false>;
+        gather(indices.data(), dictionary->data(), def_levels.data(), max_def_level_,
+               static_cast<size_t>(num_values), out);
+    } else if (header.encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY ||
+               header.encoding == Encoding::DELTA_BYTE_ARRAY) {
+        if (type_ != ParquetType::BYTE_ARRAY &&
+            !(type_ == ParquetType::FIXED_LEN_BYTE_ARRAY &&
+              header.encoding == Encoding::DELTA_BYTE_ARRAY)) {
+            throw std::runtime_error(std::string(encoding_name(header.encoding)) +
+                " is not supported for " + parquet_type_name(type_) + " columns");
+        }
+        ByteArrayBuffer strings;
+        uint32_t remaining = static_cast<uint32_t>(buf.remaining());
+        if (header.encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+            DeltaLengthByteArrayDecoder decoder(buf.current(), remaining);
+            decoder.decode(strings, static_cast<uint32_t>(num_non_null));
+        } else {
+            DeltaByteArrayDecoder decoder(buf.current(), remaining);
+            decoder.decode(strings, static_cast<uint32_t>(num_non_null));
+        }
+
+        size_t str_pos = 0;
         for (int32_t i = 0; i < num_values; i++) {
             if (def_levels[i] < max_def_level_) {
-                values.push_back(Value::null());
+                out.push_back(Value::null());
             } else {
-                int32_t idx = indices[idx_pos++];
-                if (idx >= 0 && idx < static_cast<int32_t>(dictionary->size())) {
-                    values.push_back((*dictionary)[idx]);
-                } else {
-                    values.push_back(Value::null());
-                }
+                out.push_back(make_string(strings.view(str_pos++), string_arena_));
             }
         }
-    } else if (type_ == ParquetType::BOOLEAN) {
-        // BOOLEAN PLAIN: values are bit-packed, one bit per value
-        int32_t bit_idx = 0;
-        uint8_t current_byte = 0;
+    } else if (header.encoding == Encoding::DELTA_BINARY_PACKED) {
+        // INT32/INT64 pages are handled by the page kernels
+        throw std::runtime_error("DELTA_BINARY_PACKED is only supported for INT32/INT64 columns");
+    } else if (header.encoding == Encoding::BYTE_STREAM_SPLIT) {
+        size_t width = 0;
+        switch (type_) {
+            case ParquetType::FIXED_LEN_BYTE_ARRAY:
+                width = static_cast<size_t>(type_length_);
+                if (width > 0) break;
+                [[fallthrough]];
+            default:
+                throw std::runtime_error("BYTE_STREAM_SPLIT is not supported for " +
+                    std::string(parquet_type_name(type_)) + " columns");
+        }
+        size_t stride = static_cast<size_t>(num_non_null);
+        const uint8_t* streams = buf.read_bytes(stride * width);
+        std::vector<uint8_t> decoded(stride * width);
+        byte_stream_split_decode(streams, stride, width, stride, decoded.data());
+
+        ByteBuffer decoded_buf(decoded.data(), decoded.size());
         for (int32_t i = 0; i < num_values; i++) {
             if (def_levels[i] < max_def_level_) {
-                values.push_back(Value::null());
+                out.push_back(Value::null());
             } else {
-                if (bit_idx % 8 == 0) {
-                    current_byte = buf.read_byte();
-                }
-                bool val = (current_byte >> (bit_idx % 8)) & 1;
-                values.push_back(Value::from_bool(val));
-                bit_idx++;
+                out.push_back(read_plain_value(decoded_buf, string_arena_));
             }
         }
     } else {
-        // PLAIN encoding for non-boolean types
+        // PLAIN FIXED_LEN_BYTE_ARRAY / INT96 (other types use the page kernels)
         for (int32_t i = 0; i < num_values; i++) {
             if (def_levels[i] < max_def_level_) {
-                values.push_back(Value::null());
+                out.push_back(Value::null());
             } else {
-                values.push_back(read_plain_value(buf));
+                out.push_back(read_plain_value(buf, string_arena_));
             }
         }
     }
 
-    return values;
 }
 
-Value ColumnReader::read_plain_value(ByteBuffer& buf) {
+Value ColumnReader::read_plain_value(ByteBuffer& buf, StringArena* arena) {
     switch (type_) {
         case ParquetType::BOOLEAN: {
             uint8_t b = buf.read_byte();
@@ -249,13 +374,21 @@ Value ColumnReader::read_plain_value(ByteBuffer& buf) {
         case ParquetType::BYTE_ARRAY: {
             uint32_t len = buf.read<uint32_t>();
             const uint8_t* ptr = buf.read_bytes(len);
-            return Value::from_string(std::string(reinterpret_cast<const char*>(ptr), len));
+            return make_string({reinterpret_cast<const char*>(ptr), len}, arena);
         }
         case ParquetType::FIXED_LEN_BYTE_ARRAY: {
-            throw std::runtime_error("FIXED_LEN_BYTE_ARRAY not supported without type_length");
+            if (type_length_ <= 0) {
+                throw std::runtime_error("FIXED_LEN_BYTE_ARRAY not supported without type_length");
+            }
+            const uint8_t* ptr = buf.read_bytes(static_cast<size_t>(type_length_));
+            return make_string({reinterpret_cast<const char*>(ptr), static_cast<size_t>(type_length_)},
+                               arena);
         }
         case ParquetType::INT96: {
             const uint8_t* ptr = buf.read_bytes(12);
+            if (!int96_as_string_) {
+                return Value::from_i64(int96_to_nanos(ptr));
+            }
             int64_t low;
             int32_t high;
             std::memcpy(&low, ptr, 8);
@@ -267,6 +400,11 @@ Value ColumnReader::read_plain_value(ByteBuffer& buf) {
     }
 }
 
+Value ColumnReader::make_string(std::string_view s, StringArena* arena) {
+    if (arena) return Value::from_view(arena->copy(s));
+    return Value::from_string(std::string(s));
+}
+
 uint8_t ColumnReader::bit_width(int16_t max_level) {
     if (max_level <= 0) return 0;
     uint8_t bw = 0;
@@ -274,3 +412,473 @@ uint8_t ColumnReader::bit_width(int16_t max_level) {
     while (v > 0) { bw++; v >>= 1; }
     return bw;
 }
+
+// ── Typed decoding ───────────────────────────────────────────────────────────
+
+VectorType ColumnReader::vector_type() const {
+    switch (type_) {
+        case ParquetType::BOOLEAN: return VectorType::BOOLEAN;
+        case ParquetType::INT32:   return is_decimal_ ? VectorType::DECIMAL64 : VectorType::INT32;
+        case ParquetType::INT64:   return is_decimal_ ? VectorType::DECIMAL64 : VectorType::INT64;
+        case ParquetType::FLOAT:   return VectorType::FLOAT;
+        case ParquetType::DOUBLE:  return VectorType::DOUBLE;
+        case ParquetType::BYTE_ARRAY: return VectorType::BYTE_ARRAY;
+        case ParquetType::FIXED_LEN_BYTE_ARRAY:
+            if (!is_decimal_) return VectorType::FIXED_BYTES;
+            if (precision_ > 0) {
+                return precision_ <= 18 ? VectorType::DECIMAL64 : VectorType::DECIMAL128;
+            }
+            return type_length_ <= 8 ? VectorType::DECIMAL64 : VectorType::DECIMAL128;
+        case ParquetType::INT96: return VectorType::TIMESTAMP_NS;
+        default:
+            throw std::runtime_error("Unsupported type: " + std::to_string(static_cast<int>(type_)));
+    }
+}
+
+// Width of one PLAIN-encoded value; BOOLEAN is bit-packed but unpacks to a byte.
+size_t ColumnReader::physical_width() const {
+    switch (type_) {
+        case ParquetType::BOOLEAN: return 1;
+        case ParquetType::INT32:
+        case ParquetType::FLOAT:   return 4;
+        case ParquetType::INT64:
+        case ParquetType::DOUBLE:  return 8;
+        case ParquetType::INT96:   return 12;
+        case ParquetType::FIXED_LEN_BYTE_ARRAY:
+            if (type_length_ <= 0) {
+                throw std::runtime_error("FIXED_LEN_BYTE_ARRAY not supported without type_length");
+            }
+            return static_cast<size_t>(type_length_);
+        default:
+            return 0;
+    }
+}
+
+void ColumnReader::init_vector(ColumnVector& out) const {
+    out.clear();
+    out.type = vector_type();
+    switch (out.type) {
+        case VectorType::BOOLEAN:      out.value_width = 1; break;
+        case VectorType::INT32:
+        case VectorType::FLOAT:        out.value_width = 4; break;
+        case VectorType::INT64:
+        case VectorType::DOUBLE:
+        case VectorType::DECIMAL64:
+        case VectorType::TIMESTAMP_NS: out.value_width = 8; break;
+        case VectorType::DECIMAL128:   out.value_width = 16; break;
+        case VectorType::BYTE_ARRAY:   out.value_width = 0; break;
+        case VectorType::FIXED_BYTES:  out.value_width = physical_width(); break;
+    }
+    out.scale = scale_;
+    out.precision = precision_;
+}
+
+size_t ColumnReader::read_all(ColumnVector& out) {
+    if (out.size == 0) {
+        init_vector(out);
+    } else if (out.type != vector_type()) {
+        throw std::runtime_error("ColumnVector holds " + std::string(vector_type_name(out.type)) +
+            ", column decodes to " + vector_type_name(vector_type()));
+    }
+    size_t start = out.size;
+    read_chunk(out, nullptr);
+    return out.size - start;
+}
+
+size_t ColumnReader::read_all(ListVector& out) {
+    if (max_rep_level_ == 0 || repeated_def_levels_.size() != static_cast<size_t>(max_rep_level_)) {
+        throw std::runtime_error("List assembly needs a repeated column with schema info");
+    }
+    if (out.size() == 0 || out.levels.size() != repeated_def_levels_.size()) {
+        out.levels.assign(repeated_def_levels_.size(), ListLevel{});
+        for (size_t r = 0; r < out.levels.size(); r++) {
+            int16_t parent_def = r == 0 ? 0 : repeated_def_levels_[r - 1];
+            out.levels[r].nullable = repeated_def_levels_[r] - 1 > parent_def;
+        }
+        init_vector(out.values);
+    } else if (out.values.type != vector_type()) {
+        throw std::runtime_error("ListVector holds " + std::string(vector_type_name(out.values.type)) +
+            ", column decodes to " + vector_type_name(vector_type()));
+    }
+    size_t start = out.size();
+    read_chunk(out.values, &out);
+    return out.size() - start;
+}
+
+void ColumnReader::read_chunk(ColumnVector& out, ListVector* lists) {
+    rewind();
+    while (decode_next_page(out, lists)) {
+    }
+}
+
+// ── Page cursor ──────────────────────────────────────────────────────────────
+
+void ColumnReader::rewind() {
+    page_offset_ = first_page_offset();
+    page_cursor_ = 0;
+    page_values_read_ = 0;
+    page_dictionary_.reset();
+}
+
+size_t ColumnReader::first_page_offset() const {
+    int64_t offset = meta_->data_page_offset;
+    if (meta_->dictionary_page_offset.has_value()) {
+        offset = std::min(offset, *meta_->dictionary_page_offset);
+    }
+    return static_cast<size_t>(offset);
+}
+
+// The chunk's page headers: shared from the cache when another walk
+// already recorded them, otherwise read, decoded and cached. Kept by the
+// reader, so repeated scans decode no Thrift even without a cache.
+const std::vector<CachedPageHeader>& ColumnReader::page_headers() {
+    if (!headers_ && header_cache_) headers_ = header_cache_->find(header_key_);
+    if (headers_) return *headers_;
+
+    std::vector<CachedPageHeader> headers;
+    size_t offset = first_page_offset();
+    int64_t values_read = 0;
+    while (values_read < meta_->num_values) {
+        auto header_buf = read_range_(offset, HEADER_READ_SIZE);
+        ThriftReader header_reader(header_buf.data(), header_buf.size());
+        PageHeader page_header;
+        page_header.deserialize(header_reader, /*skip_statistics=*/true);
+        headers.push_back(CachedPageHeader::from(page_header, offset, header_reader.position()));
+        values_read += headers.back().data_values();
+        offset = headers.back().end_offset();
+    }
+    headers_ = header_cache_
+        ? header_cache_->store(header_key_, std::move(headers))
+        : std::make_shared<const std::vector<CachedPageHeader>>(std::move(headers));
+    return *headers_;
+}
+
+size_t ColumnReader::read_next_page(ColumnVector& out) {
+    if (max_rep_level_ > 0) {
+        throw std::runtime_error("Page-at-a-time decode needs a non-repeated column");
+    }
+    if (out.size == 0) {
+        init_vector(out);
+    } else if (out.type != vector_type()) {
+        throw std::runtime_error("ColumnVector holds " + std::string(vector_type_name(out.type)) +
+            ", column decodes to " + vector_type_name(vector_type()));
+    }
+    size_t start = out.size;
+    decode_next_page(out, nullptr);
+    return out.size - start;
+}
+
+// Decode pages from the cursor until one data page has been appended.
+// Dictionary pages on the way are loaded, other page types skipped.
+bool ColumnReader::decode_next_page(ColumnVector& out, ListVector* lists) {
+    const auto& headers = page_headers();
+    while (page_cursor_ < headers.size()) {
+        const CachedPageHeader& page = headers[page_cursor_++];
+        page_offset_ = page.end_offset();
+
+        if (page.type == PageType::DICTIONARY_PAGE) {
+            page_dictionary_ = load_dictionary_vector(page.data_offset(), page.header());
+        } else if (page.type == PageType::DATA_PAGE) {
+            PageHeader page_header = page.header();
+            auto& dph = page_header.data_page_header.value();
+            PageSpan payload = read_page_payload(page.data_offset(), page_header);
+            read_data_page(payload.data, static_cast<int32_t>(payload.size), dph,
+                           page_dictionary_.get(), lists ? lists->values : out, lists);
+            page_values_read_ += dph.num_values;
+            return true;
+        } else if (page.type == PageType::DATA_PAGE_V2) {
+            data_page_v2_unsupported(page.offset);
+        }
+    }
+    return false;
+}
+
+void ColumnReader::read_dictionary_page(const uint8_t* data, int32_t size,
+                                        const DictionaryPageHeader& header,
+                                        ColumnVector& dict) {
+    init_vector(dict);
+    ByteBuffer buf(data, size);
+    size_t count = static_cast<size_t>(header.num_values);
+    dict.data.resize(count * dict.value_width);
+    if (type_ == ParquetType::BOOLEAN) {
+        // One byte per entry, as read_plain_value() reads dictionary booleans
+        std::memcpy(dict.data.data(), buf.read_bytes(count), count);
+    } else {
+        decode_values(buf, Encoding::PLAIN, nullptr, count, dict, 0);
+    }
+    dict.size = count;
+}
+
+void ColumnReader::read_data_page(const uint8_t* data, int32_t size,
+                                  const DataPageHeader& header,
+                                  const ColumnVector* dictionary, ColumnVector& out,
+                                  ListVector* lists) {
+    ByteBuffer buf(data, size);
+    size_t num_levels = static_cast<size_t>(header.num_values);
+    size_t base = out.size;
+
+    std::vector<int16_t>& rep_levels = scratch().rep_levels;
+    if (max_rep_level_ > 0) {
+        uint32_t rep_len = buf.read<uint32_t>();
+        if (lists) {
+            rep_levels.resize(num_levels);
+            RleDecoder rep_decoder(buf.current(), rep_len, bit_width(max_rep_level_));
+            rep_decoder.get_batch(rep_levels.data(), static_cast<uint32_t>(num_levels));
+        }
+        buf.read_bytes(rep_len);
+    }
+    std::vector<int16_t>& def_levels = scratch().def_levels;
+    if (max_def_level_ > 0) {
+        def_levels.resize(num_levels);
+        uint32_t def_len = buf.read<uint32_t>();
+        RleDecoder def_decoder(buf.current(), def_len, bit_width(max_def_level_));
+        def_decoder.get_batch(def_levels.data(), static_cast<uint32_t>(num_levels));
+        buf.read_bytes(def_len);
+    }
+
+    // Without list assembly every level entry gets a slot. With it, only
+    // entries that reach the innermost list do; the rest are empty or null
+    // lists recorded in the offsets, so drop them before the spread below.
+    size_t num_values = num_levels;
+    if (lists) {
+        assemble_lists(def_levels.data(), rep_levels.data(), num_levels, *lists);
+        int16_t slot_level = repeated_def_levels_.back();
+        num_values = 0;
+        for (size_t i = 0; i < num_levels; i++) {
+            if (def_levels[i] >= slot_level) def_levels[num_values++] = def_levels[i];
+        }
+    }
+
+    size_t num_non_null = num_values;
+    if (max_def_level_ > 0) {
+        num_non_null = 0;
+        for (size_t i = 0; i < num_values; i++) {
+            num_non_null += def_levels[i] == max_def_level_;
+        }
+    }
+
+    // Decode the non-null values densely into slots [base, base + num_non_null)
+    size_t w = out.value_width;
+    out.data.resize((base + num_values) * w);
+    decode_values(buf, header.encoding, dictionary, num_non_null, out, base);
+
+    bool nullable = lists ? max_def_level_ > repeated_def_levels_.back() : max_def_level_ > 0;
+    if (nullable) {
+        out.validity.resize((base + num_values + 7) / 8, 0);
+        set_validity_bits(out.validity.data(), base, def_levels.data(), max_def_level_, num_values);
+
+        // Move values to their slots back to front, so it can be done in place
+        if (num_non_null < num_values) {
+            if (out.type == VectorType::BYTE_ARRAY) {
+                size_t k = num_non_null;
+                out.strings.offsets.resize(base + num_values + 1);
+                uint32_t* off = out.strings.offsets.data() + base;
+                for (size_t i = num_values; i-- > 0;) {
+                    off[i + 1] = off[k];
+                    k -= def_levels[i] == max_def_level_;
+                }
+            } else {
+                spread_fixed(out.data.data() + base * w, w, def_levels.data(), max_def_level_,
+                             num_values, num_non_null);
+            }
+        }
+    }
+
+    out.null_count += num_values - num_non_null;
+    out.size += num_values;
+}
+
+// Append one page worth of (def, rep) level pairs to the list levels in a
+// single pass, with D = repeated_def_levels_. Level r gains an entry when a
+// record (r == 0) or an element of level r - 1 starts (rep <= r) and that
+// parent is present; the entry is non-null once def reaches D[r] - 1, and
+// gains an element when def >= D[r] and the element is new (rep <= r + 1).
+void ColumnReader::assemble_lists(const int16_t* def_levels, const int16_t* rep_levels,
+                                  size_t count, ListVector& lists) const {
+    const int16_t* rdl = repeated_def_levels_.data();
+    size_t depth = repeated_def_levels_.size();
+    for (size_t i = 0; i < count; i++) {
+        int16_t def = def_levels[i];
+        int16_t rep = rep_levels[i];
+        for (size_t r = 0; r < depth; r++) {
+            ListLevel& level = lists.levels[r];
+            if (rep <= static_cast<int16_t>(r)) {
+                // A new entry at this level: its parent entry is present by
+                // construction, since we only get here if def >= D[r - 1]
+                level.offsets.push_back(level.offsets.back());
+                if (level.nullable) {
+                    if (level.size % 8 == 0) level.validity.push_back(0);
+                    if (def >= rdl[r] - 1) {
+                        level.validity.back() |= static_cast<uint8_t>(1u << (level.size % 8));
+                    } else {
+                        level.null_count++;
+                    }
+                }
+                level.size++;
+            }
+            if (def < rdl[r]) break;
+            if (rep <= static_cast<int16_t>(r + 1)) level.offsets.back()++;
+        }
+    }
+}
+
+// Decode `count` non-null values into consecutive slots starting at `base`.
+// Fixed-width slots must already be allocated; strings are appended.
+void ColumnReader::decode_values(ByteBuffer& buf, Encoding encoding,
+                                 const ColumnVector* dictionary, size_t count,
+                                 ColumnVector& out, size_t base) {
+    size_t w = out.value_width;
+    uint8_t* dst = out.data.data() + base * w;
+    uint32_t remaining = static_cast<uint32_t>(buf.remaining());
+
+    if (encoding == Encoding::PLAIN_DICTIONARY || encoding == Encoding::RLE_DICTIONARY) {
+        if (!dictionary) {
+            throw std::runtime_error("Dictionary-encoded page without a dictionary page");
+        }
+        uint8_t bw = buf.read_byte();
+        RleDecoder idx_decoder(buf.current(), remaining - 1, bw);
+        std::vector<uint32_t>& indices = scratch().indices;
+        indices.resize(count);
+        idx_decoder.get_batch(indices.data(), static_cast<uint32_t>(count));
+
+        if (count > 0) {
+            uint32_t max_idx = max_dictionary_index(indices.data(), count);
+            if (max_idx >= dictionary->size) {
+                throw std::runtime_error("Dictionary index " + std::to_string(max_idx) +
+                    " out of range (dictionary size " + std::to_string(dictionary->size) + ")");
+            }
+        }
+        if (out.type == VectorType::BYTE_ARRAY) {
+            for (size_t i = 0; i < count; i++) {
+                std::string_view s = dictionary->string(indices[i]);
+                out.strings.append(s.data(), s.size());
+            }
+        } else {
+            dictionary_gather(dictionary->data.data(), w, indices.data(), count, dst);
+        }
+        return;
+    }
+
+    switch (encoding) {
+        case Encoding::PLAIN: {
+            if (type_ == ParquetType::BOOLEAN) {
+                const uint8_t* bits = buf.read_bytes((count + 7) / 8);
+                for (size_t i = 0; i < count; i++) {
+                    dst[i] = (bits[i / 8] >> (i % 8)) & 1;
+                }
+            } else if (type_ == ParquetType::BYTE_ARRAY) {
+                for (size_t i = 0; i < count; i++) {
+                    uint32_t len = buf.read<uint32_t>();
+                    const uint8_t* ptr = buf.read_bytes(len);
+                    out.strings.append(reinterpret_cast<const char*>(ptr), len);
+                }
+            } else {
+                const uint8_t* raw = buf.read_bytes(count * physical_width());
+                decode_fixed(raw, count, dst);
+            }
+            return;
+        }
+        case Encoding::DELTA_BINARY_PACKED: {
+            DeltaBinaryPackedDecoder decoder(buf.current(), remaining);
+            if (type_ == ParquetType::INT32) {
+                // Deltas wrap modulo 2^32, so decode at the physical width first
+                if (out.type == VectorType::INT32) {
+                    decoder.get_batch(reinterpret_cast<int32_t*>(dst), static_cast<uint32_t>(count));
+                } else {
+                    std::vector<int32_t> raw(count);
+                    decoder.get_batch(raw.data(), static_cast<uint32_t>(count));
+                    decode_fixed(reinterpret_cast<const uint8_t*>(raw.data()), count, dst);
+                }
+            } else if (type_ == ParquetType::INT64) {
+                decoder.get_batch(reinterpret_cast<int64_t*>(dst), static_cast<uint32_t>(count));
+            } else {
+                throw std::runtime_error("DELTA_BINARY_PACKED is only supported for INT32/INT64 columns");
+            }
+            return;
+        }
+        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+        case Encoding::DELTA_BYTE_ARRAY: {
+            if (type_ == ParquetType::BYTE_ARRAY) {
+                if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+                    DeltaLengthByteArrayDecoder decoder(buf.current(), remaining);
+                    decoder.decode(out.strings, static_cast<uint32_t>(count));
+                } else {
+                    DeltaByteArrayDecoder decoder(buf.current(), remaining);
+                    decoder.decode(out.strings, static_cast<uint32_t>(count));
+                }
+            } else if (type_ == ParquetType::FIXED_LEN_BYTE_ARRAY &&
+                       encoding == Encoding::DELTA_BYTE_ARRAY) {
+                // Equal-length values come out back to back, i.e. already fixed-stride
+                ByteArrayBuffer tmp;
+                DeltaByteArrayDecoder decoder(buf.current(), remaining);
+                decoder.decode(tmp, static_cast<uint32_t>(count));
+                if (tmp.data.size() != count * physical_width()) {
+                    throw std::runtime_error("DELTA_BYTE_ARRAY: value length does not match type_length");
+                }
+                decode_fixed(reinterpret_cast<const uint8_t*>(tmp.data.data()), count, dst);
+            } else {
+                throw std::runtime_error(std::string(encoding_name(encoding)) +
+                    " is not supported for " + parquet_type_name(type_) + " columns");
+            }
+            return;
+        }
+        case Encoding::BYTE_STREAM_SPLIT: {
+            if (type_ == ParquetType::BOOLEAN || type_ == ParquetType::BYTE_ARRAY ||
+                type_ == ParquetType::INT96) {
+                throw std::runtime_error("BYTE_STREAM_SPLIT is not supported for " +
+                    std::string(parquet_type_name(type_)) + " columns");
+            }
+            size_t pw = physical_width();
+            const uint8_t* streams = buf.read_bytes(count * pw);
+            if (out.type == VectorType::DECIMAL64 || out.type == VectorType::DECIMAL128) {
+                std::vector<uint8_t> raw(count * pw);
+                byte_stream_split_decode(streams, count, pw, count, raw.data());
+                decode_fixed(raw.data(), count, dst);
+            } else {
+                byte_stream_split_decode(streams, count, pw, count, dst);
+            }
+            return;
+        }
+        default:
+            throw std::runtime_error("Unsupported encoding: " + std::string(encoding_name(encoding)));
+    }
+}
+
+// Convert `count` PLAIN-layout physical values at `raw` into vector slots.
+void ColumnReader::decode_fixed(const uint8_t* raw, size_t count, uint8_t* dst) const {
+    size_t pw = physical_width();
+    switch (vector_type()) {
+        case VectorType::DECIMAL128:
+            decode_decimal128(raw, pw, count, reinterpret_cast<__int128*>(dst));
+            break;
+        case VectorType::TIMESTAMP_NS:
+            decode_int96_nanos(raw, count, reinterpret_cast<int64_t*>(dst));
+            break;
+        case VectorType::DECIMAL64: {
+            int64_t* out = reinterpret_cast<int64_t*>(dst);
+            if (type_ == ParquetType::INT32) {
+                for (size_t i = 0; i < count; i++) {
+                    int32_t v;
+                    std::memcpy(&v, raw + i * 4, 4);
+                    out[i] = v;
+                }
+            } else if (type_ == ParquetType::INT64) {
+                std::memcpy(dst, raw, count * 8);
+            } else if (pw <= 8) {
+                decode_decimal64(raw, pw, count, out);
+            } else {
+                // Wide FLBA holding a precision <= 18 decimal: decode and narrow
+                __int128 tmp[64];
+                for (size_t i = 0; i < count; i += 64) {
+                    size_t n = std::min<size_t>(64, count - i);
+                    decode_decimal128(raw + i * pw, pw, n, tmp);
+                    for (size_t j = 0; j < n; j++) out[i + j] = static_cast<int64_t>(tmp[j]);
+                }
+            }
+            break;
+        }
+        default:
+            std::memcpy(dst, raw, count * pw);
+            break;
+    }
+}
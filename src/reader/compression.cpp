@@ -0,0 +1,244 @@
+#include "reader/compression.hpp"
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#ifdef PARQUET_HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef PARQUET_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace {
+
+[[noreturn]] void corrupt(const char* codec, const char* what) {
+    throw std::runtime_error(std::string(codec) + ": " + what);
+}
+
+// Overlapping back-reference copy (offset may be smaller than length)
+inline void copy_match(uint8_t* op, size_t offset, size_t length) {
+    const uint8_t* match = op - offset;
+    if (offset >= length) {
+        std::memcpy(op, match, length);
+    } else {
+        for (size_t i = 0; i < length; i++) op[i] = match[i];
+    }
+}
+
+#ifdef PARQUET_HAVE_ZLIB
+// GZIP pages may hold several concatenated members; windowBits 15 + 32
+// accepts both gzip and zlib headers.
+void gzip_decompress(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size) {
+    z_stream zs{};
+    if (inflateInit2(&zs, 15 + 32) != Z_OK) corrupt("GZIP", "inflateInit2 failed");
+    zs.next_in = const_cast<Bytef*>(src);
+    zs.avail_in = static_cast<uInt>(src_size);
+    zs.next_out = dst;
+    zs.avail_out = static_cast<uInt>(dst_size);
+    int rc;
+    while ((rc = inflate(&zs, Z_FINISH)) == Z_STREAM_END && zs.avail_in > 0 && zs.avail_out > 0) {
+        inflateReset(&zs);
+    }
+    size_t produced = dst_size - zs.avail_out;
+    inflateEnd(&zs);
+    if (rc != Z_STREAM_END && rc != Z_OK && rc != Z_BUF_ERROR) corrupt("GZIP", "corrupt stream");
+    if (produced != dst_size) corrupt("GZIP", "decompressed size mismatch");
+}
+#endif
+
+#ifdef PARQUET_HAVE_ZSTD
+void zstd_decompress(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size) {
+    size_t n = ZSTD_decompress(dst, dst_size, src, src_size);
+    if (ZSTD_isError(n)) corrupt("ZSTD", ZSTD_getErrorName(n));
+    if (n != dst_size) corrupt("ZSTD", "decompressed size mismatch");
+}
+#endif
+
+constexpr size_t NUM_CODECS = static_cast<size_t>(CompressionCodec::LZ4_RAW) + 1;
+
+struct Registry {
+    std::array<std::atomic<DecompressFunc>, NUM_CODECS> funcs;
+
+    Registry() {
+        for (auto& slot : funcs) slot.store(nullptr);
+        funcs[static_cast<size_t>(CompressionCodec::SNAPPY)].store(&snappy_decompress);
+        funcs[static_cast<size_t>(CompressionCodec::LZ4_RAW)].store(&lz4_raw_decompress);
+#ifdef PARQUET_HAVE_ZLIB
+        funcs[static_cast<size_t>(CompressionCodec::GZIP)].store(&gzip_decompress);
+#endif
+#ifdef PARQUET_HAVE_ZSTD
+        funcs[static_cast<size_t>(CompressionCodec::ZSTD)].store(&zstd_decompress);
+#endif
+    }
+};
+
+std::array<std::atomic<DecompressFunc>, NUM_CODECS>& registry() {
+    static Registry instance;
+    return instance.funcs;
+}
+
+} // namespace
+
+// ── Registry ─────────────────────────────────────────────────────────────────
+
+DecompressFunc find_decompressor(CompressionCodec codec) {
+    auto idx = static_cast<size_t>(codec);
+    if (idx >= NUM_CODECS) return nullptr;
+    return registry()[idx].load(std::memory_order_acquire);
+}
+
+void register_decompressor(CompressionCodec codec, DecompressFunc func) {
+    auto idx = static_cast<size_t>(codec);
+    if (idx >= NUM_CODECS || codec == CompressionCodec::UNCOMPRESSED) {
+        throw std::runtime_error("Cannot register a decompressor for codec " +
+                                 std::to_string(static_cast<int>(codec)));
+    }
+    registry()[idx].store(func, std::memory_order_release);
+}
+
+bool codec_supported(CompressionCodec codec) {
+    return codec == CompressionCodec::UNCOMPRESSED || find_decompressor(codec) != nullptr;
+}
+
+// ── Snappy ───────────────────────────────────────────────────────────────────
+//
+// Raw Snappy block: a varint uncompressed length, then a sequence of
+// literals and back-references (1-, 2- or 4-byte offsets).
+
+void snappy_decompress(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size) {
+    const uint8_t* ip = src;
+    const uint8_t* end = src + src_size;
+
+    uint64_t length = 0;
+    for (int shift = 0;; shift += 7) {
+        if (ip >= end || shift > 35) corrupt("SNAPPY", "bad length header");
+        uint8_t b = *ip++;
+        length |= static_cast<uint64_t>(b & 0x7f) << shift;
+        if (!(b & 0x80)) break;
+    }
+    if (length != dst_size) corrupt("SNAPPY", "decompressed size mismatch");
+
+    uint8_t* op = dst;
+    uint8_t* op_end = dst + dst_size;
+    while (ip < end) {
+        uint8_t tag = *ip++;
+        size_t len, offset;
+        switch (tag & 3) {
+            case 0: {  // literal
+                len = (tag >> 2) + 1;
+                if (len > 60) {
+                    size_t extra = len - 60;
+                    if (static_cast<size_t>(end - ip) < extra) corrupt("SNAPPY", "truncated literal");
+                    len = 0;
+                    for (size_t i = 0; i < extra; i++) len |= static_cast<size_t>(ip[i]) << (8 * i);
+                    len += 1;
+                    ip += extra;
+                }
+                if (static_cast<size_t>(end - ip) < len || static_cast<size_t>(op_end - op) < len) {
+                    corrupt("SNAPPY", "literal out of bounds");
+                }
+                std::memcpy(op, ip, len);
+                ip += len;
+                op += len;
+                continue;
+            }
+            case 1:
+                if (ip >= end) corrupt("SNAPPY", "truncated copy");
+                len = 4 + ((tag >> 2) & 7);
+                offset = (static_cast<size_t>(tag >> 5) << 8) | *ip++;
+                break;
+            case 2:
+                if (end - ip < 2) corrupt("SNAPPY", "truncated copy");
+                len = (tag >> 2) + 1;
+                offset = ip[0] | (static_cast<size_t>(ip[1]) << 8);
+                ip += 2;
+                break;
+            default:
+                if (end - ip < 4) corrupt("SNAPPY", "truncated copy");
+                len = (tag >> 2) + 1;
+                offset = ip[0] | (static_cast<size_t>(ip[1]) << 8) |
+                         (static_cast<size_t>(ip[2]) << 16) | (static_cast<size_t>(ip[3]) << 24);
+                ip += 4;
+                break;
+        }
+        if (offset == 0 || offset > static_cast<size_t>(op - dst) ||
+            len > static_cast<size_t>(op_end - op)) {
+            corrupt("SNAPPY", "copy out of bounds");
+        }
+        copy_match(op, offset, len);
+        op += len;
+    }
+    if (op != op_end) corrupt("SNAPPY", "decompressed size mismatch");
+}
+
+// ── LZ4 raw block ────────────────────────────────────────────────────────────
+//
+// Sequences of (token, literals, 2-byte offset, match); the high token
+// nibble is the literal length and the low one the match length minus 4,
+// each extended by 255-valued bytes when it is 15. The last sequence has
+// literals only.
+
+void lz4_raw_decompress(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size) {
+    const uint8_t* ip = src;
+    const uint8_t* end = src + src_size;
+    uint8_t* op = dst;
+    uint8_t* op_end = dst + dst_size;
+
+    auto read_length = [&](size_t len) {
+        if (len != 15) return len;
+        uint8_t b;
+        do {
+            if (ip >= end) corrupt("LZ4_RAW", "truncated length");
+            b = *ip++;
+            len += b;
+        } while (b == 255);
+        return len;
+    };
+
+    while (ip < end) {
+        uint8_t token = *ip++;
+        size_t lit = read_length(token >> 4);
+        if (static_cast<size_t>(end - ip) < lit || static_cast<size_t>(op_end - op) < lit) {
+            corrupt("LZ4_RAW", "literal out of bounds");
+        }
+        if (lit > 0) std::memcpy(op, ip, lit);
+        ip += lit;
+        op += lit;
+        if (ip == end) break;  // last sequence
+
+        if (end - ip < 2) corrupt("LZ4_RAW", "truncated offset");
+        size_t offset = ip[0] | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        size_t len = read_length(token & 15) + 4;
+        if (offset == 0 || offset > static_cast<size_t>(op - dst) ||
+            len > static_cast<size_t>(op_end - op)) {
+            corrupt("LZ4_RAW", "match out of bounds");
+        }
+        copy_match(op, offset, len);
+        op += len;
+    }
+    if (op != op_end) corrupt("LZ4_RAW", "decompressed size mismatch");
+}
+
+// ── PageDecompressor ─────────────────────────────────────────────────────────
+
+PageDecompressor::PageDecompressor(CompressionCodec codec) : codec_(codec) {
+    if (codec_ == CompressionCodec::UNCOMPRESSED) return;
+    func_ = find_decompressor(codec_);
+    if (!func_) {
+        throw std::runtime_error(std::string("Compression codec ") + compression_name(codec_) +
+                                 " is not supported by this build");
+    }
+}
+
+PageSpan PageDecompressor::decompress(const uint8_t* stored, size_t stored_size,
+                                      size_t uncompressed_size,
+                                      std::vector<uint8_t>& buffer) const {
+    if (!func_) return {stored, stored_size};
+    if (buffer.size() < uncompressed_size) buffer.resize(uncompressed_size);
+    func_(stored, stored_size, buffer.data(), uncompressed_size);
+    return {buffer.data(), uncompressed_size};
+}
@@ -0,0 +1,161 @@
+#include "reader/crc32.hpp"
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CRC32_X86 1
+#include <immintrin.h>
+#endif
+
+// ── Slicing-by-8 ─────────────────────────────────────────────────────────────
+
+namespace {
+
+using Crc32Tables = std::array<std::array<uint32_t, 256>, 8>;
+
+// tables[k][b] is the CRC of byte b followed by k zero bytes
+constexpr Crc32Tables make_tables() {
+    Crc32Tables t{};
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++) c = (c >> 1) ^ (0xEDB88320u & (0u - (c & 1)));
+        t[0][i] = c;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        for (size_t k = 1; k < 8; k++) t[k][i] = (t[k - 1][i] >> 8) ^ t[0][t[k - 1][i] & 0xff];
+    }
+    return t;
+}
+
+constexpr Crc32Tables TABLES = make_tables();
+
+// Operates on the inverted running state
+uint32_t slicing8_update(const uint8_t* p, size_t n, uint32_t c) {
+    for (; n >= 8; n -= 8, p += 8) {
+        uint32_t lo, hi;
+        std::memcpy(&lo, p, 4);
+        std::memcpy(&hi, p + 4, 4);
+        lo ^= c;
+        c = TABLES[7][lo & 0xff] ^ TABLES[6][(lo >> 8) & 0xff] ^
+            TABLES[5][(lo >> 16) & 0xff] ^ TABLES[4][lo >> 24] ^
+            TABLES[3][hi & 0xff] ^ TABLES[2][(hi >> 8) & 0xff] ^
+            TABLES[1][(hi >> 16) & 0xff] ^ TABLES[0][hi >> 24];
+    }
+    for (; n > 0; n--, p++) c = (c >> 8) ^ TABLES[0][(c ^ *p) & 0xff];
+    return c;
+}
+
+} // namespace
+
+uint32_t crc32_slicing8(const uint8_t* data, size_t size, uint32_t crc) {
+    return ~slicing8_update(data, size, ~crc);
+}
+
+#ifdef CRC32_X86
+
+// ── PCLMULQDQ ────────────────────────────────────────────────────────────────
+//
+// Fold four 128-bit lanes 64 bytes at a time, fold them into one, then
+// reduce to 32 bits with a Barrett reduction. Constants are x^k mod P for
+// the reflected polynomial. Takes at least 64 bytes, a multiple of 16, and
+// the inverted running state.
+
+namespace {
+
+alignas(16) const uint64_t K1K2[2] = {0x0154442bd4, 0x01c6e41596};
+alignas(16) const uint64_t K3K4[2] = {0x01751997d0, 0x00ccaa009e};
+alignas(16) const uint64_t K5K0[2] = {0x0163cd6124, 0x0000000000};
+alignas(16) const uint64_t POLY[2] = {0x01db710641, 0x01f7011641};
+
+__attribute__((target("pclmul,sse4.1")))
+inline __m128i fold(__m128i acc, __m128i k, __m128i next) {
+    __m128i lo = _mm_clmulepi64_si128(acc, k, 0x00);
+    __m128i hi = _mm_clmulepi64_si128(acc, k, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(hi, lo), next);
+}
+
+__attribute__((target("pclmul,sse4.1")))
+uint32_t pclmul_update(const uint8_t* p, size_t n, uint32_t c) {
+    auto load = [](const uint8_t* q) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(q)); };
+
+    __m128i x1 = _mm_xor_si128(load(p), _mm_cvtsi32_si128(static_cast<int>(c)));
+    __m128i x2 = load(p + 16);
+    __m128i x3 = load(p + 32);
+    __m128i x4 = load(p + 48);
+    p += 64;
+    n -= 64;
+
+    __m128i k = _mm_load_si128(reinterpret_cast<const __m128i*>(K1K2));
+    for (; n >= 64; n -= 64, p += 64) {
+        x1 = fold(x1, k, load(p));
+        x2 = fold(x2, k, load(p + 16));
+        x3 = fold(x3, k, load(p + 32));
+        x4 = fold(x4, k, load(p + 48));
+    }
+
+    k = _mm_load_si128(reinterpret_cast<const __m128i*>(K3K4));
+    x1 = fold(x1, k, x2);
+    x1 = fold(x1, k, x3);
+    x1 = fold(x1, k, x4);
+    for (; n >= 16; n -= 16, p += 16) x1 = fold(x1, k, load(p));
+
+    // 128 -> 64 bits
+    __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x2 = _mm_clmulepi64_si128(x1, k, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    k = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(K5K0));
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k, 0x00), x2);
+
+    // Barrett reduction to 32 bits
+    k = _mm_load_si128(reinterpret_cast<const __m128i*>(POLY));
+    x2 = _mm_and_si128(x1, mask32);
+    x2 = _mm_clmulepi64_si128(x2, k, 0x10);
+    x2 = _mm_and_si128(x2, mask32);
+    x2 = _mm_clmulepi64_si128(x2, k, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+bool has_pclmul() {
+    static const bool supported =
+        __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+    return supported;
+}
+
+} // namespace
+
+#endif
+
+uint32_t crc32(const uint8_t* data, size_t size, uint32_t crc) {
+    uint32_t c = ~crc;
+#ifdef CRC32_X86
+    if (size >= 64 && has_pclmul()) {
+        size_t folded = size & ~size_t(15);
+        c = pclmul_update(data, folded, c);
+        data += folded;
+        size -= folded;
+    }
+#endif
+    return ~slicing8_update(data, size, c);
+}
+
+// ── PageChecksums ────────────────────────────────────────────────────────────
+
+void PageChecksums::verify(std::optional<int32_t> expected, const uint8_t* data, size_t size) {
+    if (!expected.has_value()) {
+        unchecked.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    uint32_t actual = crc32(data, size);
+    if (actual != static_cast<uint32_t>(*expected)) {
+        failed.fetch_add(1, std::memory_order_relaxed);
+        throw std::runtime_error("Page CRC mismatch: expected " +
+                                 std::to_string(static_cast<uint32_t>(*expected)) + ", got " +
+                                 std::to_string(actual));
+    }
+    verified.fetch_add(1, std::memory_order_relaxed);
+}
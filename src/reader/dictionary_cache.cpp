@@ -0,0 +1,113 @@
+#include "reader/dictionary_cache.hpp"
+
+// ── Footprint ────────────────────────────────────────────────────────────────
+
+namespace {
+
+size_t dictionary_bytes(const std::vector<Value>& dict) {
+    size_t bytes = sizeof(dict) + dict.capacity() * sizeof(Value);
+    for (const auto& v : dict) {
+        // Heap bytes of owned strings beyond the inline (SSO) buffer
+        if (auto* s = std::get_if<std::string>(&v.data); s && s->capacity() > 15) {
+            bytes += s->capacity() + 1;
+        }
+    }
+    return bytes;
+}
+
+size_t dictionary_bytes(const ColumnVector& dict) {
+    return sizeof(dict) + dict.validity.capacity() + dict.data.capacity() +
+           dict.strings.data.capacity() + dict.strings.offsets.capacity() * sizeof(uint32_t);
+}
+
+} // namespace
+
+// ── DictionaryCache ──────────────────────────────────────────────────────────
+
+DictionaryCache::Values DictionaryCache::find_values(const Key& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = values_.find(key);
+    if (it == values_.end()) return nullptr;
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return it->second->values;
+}
+
+DictionaryCache::Vector DictionaryCache::find_vector(const Key& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = vectors_.find(key);
+    if (it == vectors_.end()) return nullptr;
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return it->second->vector;
+}
+
+DictionaryCache::Values DictionaryCache::store_values(const Key& key, std::vector<Value> dict) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = values_.find(key);
+    if (it != values_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return it->second->values;
+    }
+    size_t bytes = dictionary_bytes(dict);
+    auto values = std::make_shared<const std::vector<Value>>(std::move(dict));
+    if (bytes <= budget_) insert(values_, {key, values, nullptr, bytes});
+    return values;
+}
+
+DictionaryCache::Vector DictionaryCache::store_vector(const Key& key, ColumnVector dict) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = vectors_.find(key);
+    if (it != vectors_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return it->second->vector;
+    }
+    size_t bytes = dictionary_bytes(dict);
+    auto vector = std::make_shared<const ColumnVector>(std::move(dict));
+    if (bytes <= budget_) insert(vectors_, {key, nullptr, vector, bytes});
+    return vector;
+}
+
+void DictionaryCache::insert(Index& index, Node node) {
+    Key key = node.key;
+    used_ += node.bytes;
+    lru_.push_front(std::move(node));
+    index.emplace(std::move(key), lru_.begin());
+    evict_over_budget();
+}
+
+void DictionaryCache::evict_over_budget() {
+    while (used_ > budget_ && !lru_.empty()) {
+        const Node& last = lru_.back();
+        used_ -= last.bytes;
+        (last.values ? values_ : vectors_).erase(last.key);
+        lru_.pop_back();
+    }
+}
+
+void DictionaryCache::set_budget(size_t budget_bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    budget_ = budget_bytes;
+    evict_over_budget();
+}
+
+size_t DictionaryCache::budget() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return budget_;
+}
+
+size_t DictionaryCache::memory_usage() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return used_;
+}
+
+size_t DictionaryCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lru_.size();
+}
+
+void DictionaryCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    lru_.clear();
+    values_.clear();
+    vectors_.clear();
+    used_ = 0;
+}
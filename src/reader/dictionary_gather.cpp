@@ -0,0 +1,107 @@
+#include "reader/dictionary_gather.hpp"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define GATHER_X86 1
+#include <immintrin.h>
+#endif
+
+// ── Scalar ───────────────────────────────────────────────────────────────────
+
+template <size_t W>
+static void gather_fixed(const uint8_t* dict, const uint32_t* indices, size_t count,
+                         uint8_t* out) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        std::memcpy(out + (i + 0) * W, dict + size_t(indices[i + 0]) * W, W);
+        std::memcpy(out + (i + 1) * W, dict + size_t(indices[i + 1]) * W, W);
+        std::memcpy(out + (i + 2) * W, dict + size_t(indices[i + 2]) * W, W);
+        std::memcpy(out + (i + 3) * W, dict + size_t(indices[i + 3]) * W, W);
+    }
+    for (; i < count; i++) {
+        std::memcpy(out + i * W, dict + size_t(indices[i]) * W, W);
+    }
+}
+
+void dictionary_gather_scalar(const uint8_t* dict, size_t width, const uint32_t* indices,
+                              size_t count, uint8_t* out) {
+    switch (width) {
+        case 1:  gather_fixed<1>(dict, indices, count, out); return;
+        case 2:  gather_fixed<2>(dict, indices, count, out); return;
+        case 4:  gather_fixed<4>(dict, indices, count, out); return;
+        case 8:  gather_fixed<8>(dict, indices, count, out); return;
+        case 16: gather_fixed<16>(dict, indices, count, out); return;
+        default:
+            for (size_t i = 0; i < count; i++) {
+                std::memcpy(out + i * width, dict + size_t(indices[i]) * width, width);
+            }
+    }
+}
+
+uint32_t max_dictionary_index(const uint32_t* indices, size_t count) {
+    uint32_t m = 0;
+    for (size_t i = 0; i < count; i++) m = indices[i] > m ? indices[i] : m;
+    return m;
+}
+
+#ifdef GATHER_X86
+
+// ── AVX2 ─────────────────────────────────────────────────────────────────────
+
+// Indices are used as signed 32-bit offsets, so dictionaries are limited to
+// 2^31 entries, far beyond what fits in a dictionary page.
+__attribute__((target("avx2")))
+static size_t gather4_avx2(const uint8_t* dict, const uint32_t* indices, size_t count,
+                           uint8_t* out) {
+    const int* base = reinterpret_cast<const int*>(dict);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i + 8));
+        __m256i va = _mm256_i32gather_epi32(base, a, 4);
+        __m256i vb = _mm256_i32gather_epi32(base, b, 4);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 4), va);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + (i + 8) * 4), vb);
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+static size_t gather8_avx2(const uint8_t* dict, const uint32_t* indices, size_t count,
+                           uint8_t* out) {
+    const long long* base = reinterpret_cast<const long long*>(dict);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i + 4));
+        __m256i va = _mm256_i32gather_epi64(base, a, 8);
+        __m256i vb = _mm256_i32gather_epi64(base, b, 8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 8), va);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + (i + 4) * 8), vb);
+    }
+    return i;
+}
+
+static bool has_avx2() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+#endif // GATHER_X86
+
+// ── Dispatch ─────────────────────────────────────────────────────────────────
+
+void dictionary_gather(const uint8_t* dict, size_t width, const uint32_t* indices,
+                       size_t count, uint8_t* out) {
+    size_t done = 0;
+#ifdef GATHER_X86
+    if (has_avx2()) {
+        if (width == 4) {
+            done = gather4_avx2(dict, indices, count, out);
+        } else if (width == 8) {
+            done = gather8_avx2(dict, indices, count, out);
+        }
+    }
+#endif
+    dictionary_gather_scalar(dict, width, indices + done, count - done, out + done * width);
+}
@@ -1,4 +1,11 @@
 #include "reader/metadata.hpp"
+#include <algorithm>
+
+// Capacity to reserve for a list: every element takes at least a byte, so a
+// corrupt count cannot reserve more than the rest of the buffer
+static size_t list_capacity(const ThriftReader& reader, const ThriftReader::ListHeader& lh) {
+    return lh.count > 0 ? std::min(static_cast<size_t>(lh.count), reader.remaining()) : 0;
+}
 
 // ── SchemaElement ──────────────────────────────────────────────────────────────
 
@@ -27,13 +34,42 @@ void Statistics::deserialize(ThriftReader& reader) {
     while (true) {
         auto fh = reader.read_field_begin();
         if (fh.type == ThriftCompactType::CT_STOP) break;
-        reader.skip(fh.type);
+        switch (fh.field_id) {
+            case 1: max = reader.read_binary(); break;
+            case 2: min = reader.read_binary(); break;
+            case 3: null_count = reader.read_i64(); break;
+            case 4: distinct_count = reader.read_i64(); break;
+            case 5: max_value = reader.read_binary(); break;
+            case 6: min_value = reader.read_binary(); break;
+            case 7: is_max_value_exact = reader.read_bool(fh.type); break;
+            case 8: is_min_value_exact = reader.read_bool(fh.type); break;
+            default: reader.skip(fh.type); break;
+        }
     }
 }
 
 // ── ColumnMetaData ─────────────────────────────────────────────────────────────
 
-void ColumnMetaData::deserialize(ThriftReader& reader) {
+// Read a path_in_schema list, returning `previous` without allocating when
+// the list spells the same path.
+static ColumnPath read_path(ThriftReader& reader, const ColumnPath& previous) {
+    ThriftReader start = reader;
+    auto lh = reader.read_list_begin();
+    bool same = previous && previous->size() == static_cast<size_t>(std::max(lh.count, 0));
+    for (int32_t i = 0; i < lh.count; i++) {
+        std::string_view part = reader.read_string_view();
+        same = same && part == (*previous)[static_cast<size_t>(i)];
+    }
+    if (same) return previous;
+
+    lh = start.read_list_begin();
+    auto path = std::make_shared<std::vector<std::string>>();
+    path->reserve(list_capacity(start, lh));
+    for (int32_t i = 0; i < lh.count; i++) path->emplace_back(start.read_string_view());
+    return path;
+}
+
+void ColumnMetaData::deserialize(ThriftReader& reader, const ColumnMetaData* previous) {
     while (true) {
         auto fh = reader.read_field_begin();
         if (fh.type == ThriftCompactType::CT_STOP) break;
@@ -41,16 +77,14 @@ void ColumnMetaData::deserialize(ThriftReader& reader) {
             case 1: type = static_cast<ParquetType>(reader.read_i32()); break;
             case 2: {
                 auto lh = reader.read_list_begin();
+                encodings.reserve(list_capacity(reader, lh));
                 for (int32_t i = 0; i < lh.count; i++)
                     encodings.push_back(static_cast<Encoding>(reader.read_i32()));
                 break;
             }
-            case 3: {
-                auto lh = reader.read_list_begin();
-                for (int32_t i = 0; i < lh.count; i++)
-                    path_in_schema.push_back(reader.read_string());
+            case 3:
+                path_in_schema = read_path(reader, previous ? previous->path_in_schema : nullptr);
                 break;
-            }
             case 4: codec = static_cast<CompressionCodec>(reader.read_i32()); break;
             case 5: num_values = reader.read_i64(); break;
             case 6: total_uncompressed_size = reader.read_i64(); break;
@@ -58,6 +92,46 @@ void ColumnMetaData::deserialize(ThriftReader& reader) {
             case 9: data_page_offset = reader.read_i64(); break;
             case 10: index_page_offset = reader.read_i64(); break;
             case 11: dictionary_page_offset = reader.read_i64(); break;
+            case 12: {
+                reader.read_struct_begin();
+                Statistics stats;
+                stats.deserialize(reader);
+                statistics = std::move(stats);
+                reader.read_struct_end();
+                break;
+            }
+            case 14: bloom_filter_offset = reader.read_i64(); break;
+            case 15: bloom_filter_length = reader.read_i32(); break;
+            default: reader.skip(fh.type); break;
+        }
+    }
+}
+
+// ── BloomFilterHeader ──────────────────────────────────────────────────────────
+
+// True if the union struct that follows has its field 1 set
+static bool read_union_first(ThriftReader& reader) {
+    bool first = false;
+    reader.read_struct_begin();
+    while (true) {
+        auto fh = reader.read_field_begin();
+        if (fh.type == ThriftCompactType::CT_STOP) break;
+        if (fh.field_id == 1) first = true;
+        reader.skip(fh.type);
+    }
+    reader.read_struct_end();
+    return first;
+}
+
+void BloomFilterHeader::deserialize(ThriftReader& reader) {
+    while (true) {
+        auto fh = reader.read_field_begin();
+        if (fh.type == ThriftCompactType::CT_STOP) break;
+        switch (fh.field_id) {
+            case 1: num_bytes = reader.read_i32(); break;
+            case 2: split_block = read_union_first(reader); break;
+            case 3: xxhash = read_union_first(reader); break;
+            case 4: uncompressed = read_union_first(reader); break;
             default: reader.skip(fh.type); break;
         }
     }
@@ -65,7 +139,7 @@ void ColumnMetaData::deserialize(ThriftReader& reader) {
 
 // ── ColumnChunk ────────────────────────────────────────────────────────────────
 
-void ColumnChunk::deserialize(ThriftReader& reader) {
+void ColumnChunk::deserialize(ThriftReader& reader, bool lazy, const ColumnChunk* previous) {
     while (true) {
         auto fh = reader.read_field_begin();
         if (fh.type == ThriftCompactType::CT_STOP) break;
@@ -73,13 +147,159 @@ void ColumnChunk::deserialize(ThriftReader& reader) {
             case 1: file_path = reader.read_string(); break;
             case 2: file_offset = reader.read_i64(); break;
             case 3: {
+                if (lazy) {
+                    meta_data_offset = reader.position();
+                    reader.skip(fh.type);
+                    meta_data_size = reader.position() - meta_data_offset;
+                    break;
+                }
                 reader.read_struct_begin();
-                ColumnMetaData cmd;
-                cmd.deserialize(reader);
+                auto cmd = std::make_shared<ColumnMetaData>();
+                cmd->deserialize(reader, previous ? previous->meta_data.get() : nullptr);
                 meta_data = std::move(cmd);
                 reader.read_struct_end();
                 break;
             }
+            case 4: offset_index_offset = reader.read_i64(); break;
+            case 5: offset_index_length = reader.read_i32(); break;
+            case 6: column_index_offset = reader.read_i64(); break;
+            case 7: column_index_length = reader.read_i32(); break;
+            default: reader.skip(fh.type); break;
+        }
+    }
+}
+
+void ColumnChunk::decode_meta_data(const uint8_t* footer, const ColumnChunk* previous) {
+    if (meta_data || meta_data_size == 0) return;
+    ThriftReader reader(footer + meta_data_offset, meta_data_size);
+    auto cmd = std::make_shared<ColumnMetaData>();
+    cmd->deserialize(reader, previous ? previous->meta_data.get() : nullptr);
+    meta_data = std::move(cmd);
+}
+
+// ── ChunkTable ─────────────────────────────────────────────────────────────────
+
+void ChunkTable::resize(size_t row_groups, size_t columns) {
+    num_row_groups = row_groups;
+    num_columns = columns;
+    size_t n = row_groups * columns;
+    data_page_offset.assign(n, 0);
+    dictionary_page_offset.assign(n, -1);
+    total_compressed_size.assign(n, 0);
+    total_uncompressed_size.assign(n, 0);
+    num_values.assign(n, 0);
+    codec.assign(n, CompressionCodec::UNCOMPRESSED);
+}
+
+void ChunkTable::assign(size_t row_group_idx, size_t col_idx, const ColumnChunk& chunk,
+                        const uint8_t* footer) {
+    size_t i = index(row_group_idx, col_idx);
+    if (chunk.meta_data) {
+        const auto& meta = *chunk.meta_data;
+        data_page_offset[i] = meta.data_page_offset;
+        dictionary_page_offset[i] = meta.dictionary_page_offset.value_or(-1);
+        total_compressed_size[i] = meta.total_compressed_size;
+        total_uncompressed_size[i] = meta.total_uncompressed_size;
+        num_values[i] = meta.num_values;
+        codec[i] = meta.codec;
+        return;
+    }
+    if (chunk.meta_data_size == 0 || !footer) return;
+
+    // The numeric fields only; paths, encodings and statistics are skipped
+    ThriftReader reader(footer + chunk.meta_data_offset, chunk.meta_data_size);
+    while (true) {
+        auto fh = reader.read_field_begin();
+        if (fh.type == ThriftCompactType::CT_STOP) break;
+        switch (fh.field_id) {
+            case 4: codec[i] = static_cast<CompressionCodec>(reader.read_i32()); break;
+            case 5: num_values[i] = reader.read_i64(); break;
+            case 6: total_uncompressed_size[i] = reader.read_i64(); break;
+            case 7: total_compressed_size[i] = reader.read_i64(); break;
+            case 9: data_page_offset[i] = reader.read_i64(); break;
+            case 11: dictionary_page_offset[i] = reader.read_i64(); break;
+            default: reader.skip(fh.type); break;
+        }
+    }
+}
+
+// ── OffsetIndex ────────────────────────────────────────────────────────────────
+
+void PageLocation::deserialize(ThriftReader& reader) {
+    while (true) {
+        auto fh = reader.read_field_begin();
+        if (fh.type == ThriftCompactType::CT_STOP) break;
+        switch (fh.field_id) {
+            case 1: offset = reader.read_i64(); break;
+            case 2: compressed_page_size = reader.read_i32(); break;
+            case 3: first_row_index = reader.read_i64(); break;
+            default: reader.skip(fh.type); break;
+        }
+    }
+}
+
+void OffsetIndex::deserialize(ThriftReader& reader) {
+    while (true) {
+        auto fh = reader.read_field_begin();
+        if (fh.type == ThriftCompactType::CT_STOP) break;
+        switch (fh.field_id) {
+            case 1: {
+                auto lh = reader.read_list_begin();
+                page_locations.reserve(list_capacity(reader, lh));
+                for (int32_t i = 0; i < lh.count; i++) {
+                    page_locations.emplace_back();
+                    reader.read_struct_begin();
+                    page_locations.back().deserialize(reader);
+                    reader.read_struct_end();
+                }
+                break;
+            }
+            case 2: {
+                auto lh = reader.read_list_begin();
+                unencoded_byte_array_data_bytes.reserve(list_capacity(reader, lh));
+                for (int32_t i = 0; i < lh.count; i++)
+                    unencoded_byte_array_data_bytes.push_back(reader.read_i64());
+                break;
+            }
+            default: reader.skip(fh.type); break;
+        }
+    }
+}
+
+// ── ColumnIndex ────────────────────────────────────────────────────────────────
+
+void ColumnIndex::deserialize(ThriftReader& reader) {
+    while (true) {
+        auto fh = reader.read_field_begin();
+        if (fh.type == ThriftCompactType::CT_STOP) break;
+        switch (fh.field_id) {
+            case 1: {
+                // List elements are one byte each, 1 for true
+                auto lh = reader.read_list_begin();
+                null_pages.reserve(list_capacity(reader, lh));
+                for (int32_t i = 0; i < lh.count; i++)
+                    null_pages.push_back(reader.read_i8() == ThriftCompactType::CT_BOOLEAN_TRUE);
+                break;
+            }
+            case 2: {
+                auto lh = reader.read_list_begin();
+                min_values.reserve(list_capacity(reader, lh));
+                for (int32_t i = 0; i < lh.count; i++) min_values.push_back(reader.read_binary());
+                break;
+            }
+            case 3: {
+                auto lh = reader.read_list_begin();
+                max_values.reserve(list_capacity(reader, lh));
+                for (int32_t i = 0; i < lh.count; i++) max_values.push_back(reader.read_binary());
+                break;
+            }
+            case 4: boundary_order = static_cast<BoundaryOrder>(reader.read_i32()); break;
+            case 5: {
+                auto lh = reader.read_list_begin();
+                null_counts.reserve(list_capacity(reader, lh));
+                for (int32_t i = 0; i < lh.count; i++) null_counts.push_back(reader.read_i64());
+                break;
+            }
             default: reader.skip(fh.type); break;
         }
     }
@@ -87,7 +307,7 @@ void ColumnChunk::deserialize(ThriftReader& reader) {
 
 // ── DataPageHeader ─────────────────────────────────────────────────────────────
 
-void DataPageHeader::deserialize(ThriftReader& reader) {
+void DataPageHeader::deserialize(ThriftReader& reader, bool skip_statistics) {
     while (true) {
         auto fh = reader.read_field_begin();
         if (fh.type == ThriftCompactType::CT_STOP) break;
@@ -96,6 +316,49 @@ void DataPageHeader::deserialize(ThriftReader& reader) {
             case 2: encoding = static_cast<Encoding>(reader.read_i32()); break;
             case 3: definition_level_encoding = static_cast<Encoding>(reader.read_i32()); break;
             case 4: repetition_level_encoding = static_cast<Encoding>(reader.read_i32()); break;
+            case 5: {
+                if (skip_statistics) {
+                    reader.skip(fh.type);
+                    break;
+                }
+                reader.read_struct_begin();
+                Statistics stats;
+                stats.deserialize(reader);
+                statistics = std::move(stats);
+                reader.read_struct_end();
+                break;
+            }
+            default: reader.skip(fh.type); break;
+        }
+    }
+}
+
+// ── DataPageHeaderV2 ───────────────────────────────────────────────────────────
+
+void DataPageHeaderV2::deserialize(ThriftReader& reader, bool skip_statistics) {
+    while (true) {
+        auto fh = reader.read_field_begin();
+        if (fh.type == ThriftCompactType::CT_STOP) break;
+        switch (fh.field_id) {
+            case 1: num_values = reader.read_i32(); break;
+            case 2: num_nulls = reader.read_i32(); break;
+            case 3: num_rows = reader.read_i32(); break;
+            case 4: encoding = static_cast<Encoding>(reader.read_i32()); break;
+            case 5: definition_levels_byte_length = reader.read_i32(); break;
+            case 6: repetition_levels_byte_length = reader.read_i32(); break;
+            case 7: is_compressed = reader.read_bool(fh.type); break;
+            case 8: {
+                if (skip_statistics) {
+                    reader.skip(fh.type);
+                    break;
+                }
+                reader.read_struct_begin();
+                Statistics stats;
+                stats.deserialize(reader);
+                statistics = std::move(stats);
+                reader.read_struct_end();
+                break;
+            }
             default: reader.skip(fh.type); break;
         }
     }
@@ -118,7 +381,7 @@ void DictionaryPageHeader::deserialize(ThriftReader& reader) {
 
 // ── PageHeader ─────────────────────────────────────────────────────────────────
 
-void PageHeader::deserialize(ThriftReader& reader) {
+void PageHeader::deserialize(ThriftReader& reader, bool skip_statistics) {
     while (true) {
         auto fh = reader.read_field_begin();
         if (fh.type == ThriftCompactType::CT_STOP) break;
@@ -130,7 +393,7 @@ void PageHeader::deserialize(ThriftReader& reader) {
             case 5: {
                 reader.read_struct_begin();
                 DataPageHeader dph;
-                dph.deserialize(reader);
+                dph.deserialize(reader, skip_statistics);
                 data_page_header = std::move(dph);
                 reader.read_struct_end();
                 break;
@@ -146,9 +409,29 @@ void PageHeader::deserialize(ThriftReader& reader) {
                 reader.read_struct_end();
                 break;
             }
-            case 8:
-                reader.skip(fh.type);
+            case 8: {
+                reader.read_struct_begin();
+                DataPageHeaderV2 dph;
+                dph.deserialize(reader, skip_statistics);
+                data_page_header_v2 = std::move(dph);
+                reader.read_struct_end();
                 break;
+            }
+            default: reader.skip(fh.type); break;
+        }
+    }
+}
+
+// ── SortingColumn ──────────────────────────────────────────────────────────────
+
+void SortingColumn::deserialize(ThriftReader& reader) {
+    while (true) {
+        auto fh = reader.read_field_begin();
+        if (fh.type == ThriftCompactType::CT_STOP) break;
+        switch (fh.field_id) {
+            case 1: column_idx = reader.read_i32(); break;
+            case 2: descending = reader.read_bool(fh.type); break;
+            case 3: nulls_first = reader.read_bool(fh.type); break;
             default: reader.skip(fh.type); break;
         }
     }
@@ -156,17 +439,21 @@ void PageHeader::deserialize(ThriftReader& reader) {
 
 // ── RowGroup ───────────────────────────────────────────────────────────────────
 
-void RowGroup::deserialize(ThriftReader& reader) {
+void RowGroup::deserialize(ThriftReader& reader, bool lazy, const RowGroup* previous) {
     while (true) {
         auto fh = reader.read_field_begin();
         if (fh.type == ThriftCompactType::CT_STOP) break;
         switch (fh.field_id) {
             case 1: {
                 auto lh = reader.read_list_begin();
+                columns.reserve(list_capacity(reader, lh));
                 for (int32_t i = 0; i < lh.count; i++) {
+                    size_t idx = static_cast<size_t>(i);
                     reader.read_struct_begin();
                     ColumnChunk cc;
-                    cc.deserialize(reader);
+                    cc.deserialize(reader, lazy,
+                                   previous && idx < previous->columns.size()
+                                       ? &previous->columns[idx] : nullptr);
                     columns.push_back(std::move(cc));
                     reader.read_struct_end();
                 }
@@ -174,6 +461,18 @@ void RowGroup::deserialize(ThriftReader& reader) {
             }
             case 2: total_byte_size = reader.read_i64(); break;
             case 3: num_rows = reader.read_i64(); break;
+            case 4: {
+                auto lh = reader.read_list_begin();
+                sorting_columns.reserve(list_capacity(reader, lh));
+                for (int32_t i = 0; i < lh.count; i++) {
+                    reader.read_struct_begin();
+                    SortingColumn sc;
+                    sc.deserialize(reader);
+                    sorting_columns.push_back(sc);
+                    reader.read_struct_end();
+                }
+                break;
+            }
             default: reader.skip(fh.type); break;
         }
     }
@@ -195,7 +494,7 @@ void KeyValue::deserialize(ThriftReader& reader) {
 
 // ── FileMetaData ───────────────────────────────────────────────────────────────
 
-void FileMetaData::deserialize(ThriftReader& reader) {
+void FileMetaData::deserialize(ThriftReader& reader, bool lazy) {
     while (true) {
         auto fh = reader.read_field_begin();
         if (fh.type == ThriftCompactType::CT_STOP) break;
@@ -203,6 +502,7 @@ void FileMetaData::deserialize(ThriftReader& reader) {
             case 1: version = reader.read_i32(); break;
             case 2: {
                 auto lh = reader.read_list_begin();
+                schema.reserve(list_capacity(reader, lh));
                 for (int32_t i = 0; i < lh.count; i++) {
                     reader.read_struct_begin();
                     SchemaElement se;
@@ -215,10 +515,11 @@ void FileMetaData::deserialize(ThriftReader& reader) {
             case 3: num_rows = reader.read_i64(); break;
             case 4: {
                 auto lh = reader.read_list_begin();
+                row_groups.reserve(list_capacity(reader, lh));
                 for (int32_t i = 0; i < lh.count; i++) {
                     reader.read_struct_begin();
                     RowGroup rg;
-                    rg.deserialize(reader);
+                    rg.deserialize(reader, lazy, row_groups.empty() ? nullptr : &row_groups.back());
                     row_groups.push_back(std::move(rg));
                     reader.read_struct_end();
                 }
@@ -0,0 +1,203 @@
+#include "reader/metadata_cache.hpp"
+#include "reader/parquet_reader.hpp"
+#include <functional>
+
+// ── ParsedFile footprint ─────────────────────────────────────────────────────
+
+namespace {
+
+// Heap bytes of a string beyond its inline (SSO) buffer, plus the object
+size_t string_bytes(const std::string& s) {
+    return sizeof(std::string) + (s.capacity() > 15 ? s.capacity() + 1 : 0);
+}
+
+size_t statistics_bytes(const std::optional<Statistics>& stats) {
+    if (!stats) return 0;
+    size_t bytes = 0;
+    for (const auto* bound : {&stats->max, &stats->min, &stats->max_value, &stats->min_value}) {
+        if (*bound) bytes += string_bytes(**bound);
+    }
+    return bytes;
+}
+
+} // namespace
+
+size_t ParsedFile::memory_usage() const {
+    size_t bytes = sizeof(ParsedFile) + footer.capacity() + projected.capacity() / 8;
+
+    for (const auto& elem : metadata.schema) bytes += sizeof(SchemaElement) + string_bytes(elem.name);
+    for (const auto& kv : metadata.key_value_metadata) {
+        bytes += sizeof(KeyValue) + string_bytes(kv.key) + (kv.value ? string_bytes(*kv.value) : 0);
+    }
+    const auto& row_groups = metadata.row_groups;
+    for (size_t rg = 0; rg < row_groups.size(); rg++) {
+        bytes += sizeof(RowGroup) + row_groups[rg].columns.capacity() * sizeof(ColumnChunk) +
+                 row_groups[rg].sorting_columns.capacity() * sizeof(SortingColumn);
+        for (size_t col = 0; col < row_groups[rg].columns.size(); col++) {
+            const auto& chunk = row_groups[rg].columns[col];
+            if (chunk.file_path) bytes += string_bytes(*chunk.file_path);
+            bytes += chunk_meta_bytes(rg, col);
+        }
+    }
+    bytes += chunks.data_page_offset.capacity() * sizeof(int64_t) * 5 +
+             chunks.codec.capacity() * sizeof(CompressionCodec);
+
+    for (const auto& col : columns) {
+        bytes += sizeof(ColumnInfo) + string_bytes(col.name) + string_bytes(col.path) +
+                 col.repeated_def_levels.capacity() * sizeof(int16_t);
+    }
+    // Node, key and bucket per name
+    for (const auto& [name, idx] : column_name_to_idx) {
+        bytes += string_bytes(name) + sizeof(idx) + 3 * sizeof(void*);
+    }
+    bytes += page_index.capacity() * sizeof(PageIndexEntry) +
+             row_group_first_row.capacity() * sizeof(int64_t);
+
+    for (const auto& rg : chunk_pages) {
+        bytes += rg.capacity() * sizeof(ChunkPages);
+        for (const auto& pages : rg) {
+            if (pages.offset_index) {
+                bytes += sizeof(OffsetIndex) +
+                         pages.offset_index->page_locations.capacity() * sizeof(PageLocation) +
+                         pages.offset_index->unencoded_byte_array_data_bytes.capacity() * sizeof(int64_t);
+            }
+            if (pages.column_index) {
+                const auto& ci = *pages.column_index;
+                bytes += sizeof(ColumnIndex) + ci.null_pages.capacity() / 8 + ci.null_counts.capacity() * sizeof(int64_t);
+                for (const auto& v : ci.min_values) bytes += string_bytes(v);
+                for (const auto& v : ci.max_values) bytes += string_bytes(v);
+            }
+        }
+    }
+    return bytes + page_headers.memory_usage();
+}
+
+size_t ParsedFile::chunk_meta_bytes(size_t row_group_idx, size_t col_idx) const {
+    const auto& row_groups = metadata.row_groups;
+    const auto& chunk = row_groups[row_group_idx].columns[col_idx];
+    if (!chunk.meta_data) return 0;
+    const auto& meta = *chunk.meta_data;
+    size_t bytes = sizeof(ColumnMetaData) + meta.encodings.capacity() * sizeof(Encoding) +
+                   statistics_bytes(meta.statistics);
+    // Paths shared with the first row group are counted there
+    const auto& first = row_groups[0].columns;
+    bool shared = row_group_idx > 0 && col_idx < first.size() && first[col_idx].meta_data &&
+                  first[col_idx].meta_data->path_in_schema == meta.path_in_schema;
+    if (meta.path_in_schema && !shared) {
+        for (const auto& part : *meta.path_in_schema) bytes += string_bytes(part);
+    }
+    return bytes;
+}
+
+// ── MetadataCache ────────────────────────────────────────────────────────────
+
+size_t MetadataCache::KeyHash::operator()(const Key& key) const {
+    size_t h = std::hash<std::string>{}(key.path);
+    h ^= std::hash<uint64_t>{}(key.size) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+    h ^= std::hash<int64_t>{}(key.mtime) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+    return h;
+}
+
+std::shared_ptr<MetadataCache> MetadataCache::global() {
+    static std::shared_ptr<MetadataCache> cache = std::make_shared<MetadataCache>();
+    return cache;
+}
+
+MetadataCache::~MetadataCache() {
+    for (auto& node : lru_) node.file->growth.attach(nullptr);
+}
+
+MetadataCache::Entry MetadataCache::find(const Key& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    charge_growth();
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        misses_++;
+        return nullptr;
+    }
+    hits_++;
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return it->second->file;
+}
+
+MetadataCache::Entry MetadataCache::insert(const Key& key, Entry file, size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    charge_growth();
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return it->second->file;
+    }
+    if (bytes > budget_) return file;
+    // Growth up to now is part of `bytes`; later growth is reported
+    size_t growth = file->growth.attach(&pending_growth_);
+    lru_.push_front({key, file, bytes, growth});
+    index_.emplace(key, lru_.begin());
+    used_ += bytes;
+    evict_over_budget();
+    return file;
+}
+
+// Entries grow while shared: readers decode ColumnMetaData on first use
+// and record page headers. Each reports what it adds to pending_growth_.
+void MetadataCache::charge_growth() {
+    used_ += pending_growth_.exchange(0, std::memory_order_relaxed);
+    evict_over_budget();
+}
+
+// Stop the node's growth being reported, then take all it was charged off
+// used_. Everything reported before attach() returns is in pending_growth_
+// or used_ already, so it is charged first.
+void MetadataCache::detach(Node& node) {
+    size_t growth = node.file->growth.attach(nullptr);
+    used_ += pending_growth_.exchange(0, std::memory_order_relaxed);
+    used_ -= node.bytes + (growth - node.growth);
+}
+
+void MetadataCache::evict_over_budget() {
+    while (used_ > budget_ && !lru_.empty()) {
+        detach(lru_.back());
+        index_.erase(lru_.back().key);
+        lru_.pop_back();
+    }
+}
+
+void MetadataCache::set_budget(size_t budget_bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    budget_ = budget_bytes;
+    charge_growth();
+}
+
+size_t MetadataCache::budget() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return budget_;
+}
+
+size_t MetadataCache::memory_usage() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return used_ + pending_growth_.load(std::memory_order_relaxed);
+}
+
+size_t MetadataCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lru_.size();
+}
+
+uint64_t MetadataCache::hits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+}
+
+uint64_t MetadataCache::misses() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+}
+
+void MetadataCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& node : lru_) node.file->growth.attach(nullptr);
+    pending_growth_ = 0;
+    lru_.clear();
+    index_.clear();
+    used_ = 0;
+}
@@ -0,0 +1,134 @@
+#include "reader/page_pipeline.hpp"
+#include <cstring>
+#include <string>
+
+PagePipeline::PagePipeline(ReadRangeFunc read_range, const ColumnMetaData& meta,
+                           std::shared_ptr<ThreadPool> pool, size_t depth,
+                           PageChecksums* checksums)
+    : read_range_(std::move(read_range)), pool_(std::move(pool)), checksums_(checksums),
+      depth_(depth == 0 ? 1 : depth),
+      num_values_(meta.num_values) {
+    if (meta.codec != CompressionCodec::UNCOMPRESSED) {
+        decompress_ = find_decompressor(meta.codec);
+        if (!decompress_) {
+            throw std::runtime_error(std::string("Compression codec ") +
+                                     compression_name(meta.codec) +
+                                     " is not supported by this build");
+        }
+    }
+    int64_t offset = meta.data_page_offset;
+    if (meta.dictionary_page_offset.has_value()) {
+        offset = std::min(offset, *meta.dictionary_page_offset);
+    }
+    offset_ = static_cast<size_t>(offset);
+}
+
+PagePipeline::~PagePipeline() {
+    for (auto& p : pending_) {
+        if (p.data.valid()) p.data.wait();
+    }
+}
+
+bool PagePipeline::next(Page& page) {
+    fill();
+    if (pending_.empty()) return false;
+
+    Pending front = std::move(pending_.front());
+    pending_.pop_front();
+    if (decompress_ && page.data.capacity() > 0 && free_buffers_.size() < depth_) {
+        free_buffers_.push_back(std::move(page.data));
+    }
+    page.header = std::move(front.header);
+    page.data = front.data.get();  // rethrows decompression errors
+
+    // Queue the following pages before the caller starts decoding this one
+    if (pool_) fill();
+    return true;
+}
+
+void PagePipeline::set_page_header_cache(PageHeaderCache* cache, PageHeaderCache::Key key) {
+    header_cache_ = cache;
+    header_key_ = key;
+    headers_ = cache ? cache->find(key) : nullptr;
+}
+
+void PagePipeline::fill() {
+    while (pending_.size() < depth_ && values_scanned_ < num_values_) {
+        CachedPageHeader page;
+        if (headers_) {
+            if (next_header_ == headers_->size()) break;
+            page = (*headers_)[next_header_++];
+        } else {
+            auto header_buf = read_range_(offset_, HEADER_READ_SIZE);
+            ThriftReader header_reader(header_buf.data(), header_buf.size());
+            PageHeader header;
+            header.deserialize(header_reader, /*skip_statistics=*/true);
+            page = CachedPageHeader::from(header, offset_, header_reader.position());
+            recorded_.push_back(page);
+        }
+        Pending p;
+        p.header = page.header();
+        size_t data_offset = page.data_offset();
+        size_t stored_size = static_cast<size_t>(page.compressed_page_size);
+        offset_ = page.end_offset();
+        values_scanned_ += page.data_values();
+        if (!headers_ && header_cache_ && values_scanned_ >= num_values_) {
+            headers_ = header_cache_->store(header_key_, std::move(recorded_));
+            next_header_ = headers_->size();
+        }
+
+        if (skip_dictionary_ && page.type == PageType::DICTIONARY_PAGE) {
+            std::promise<std::vector<uint8_t>> ready;
+            ready.set_value({});
+            p.data = ready.get_future();
+            pending_.push_back(std::move(p));
+            continue;
+        }
+
+        auto stored = read_range_(data_offset, stored_size);
+        if (!decompress_ || (page.flags & CachedPageHeader::VALUES_UNCOMPRESSED)) {
+            std::promise<std::vector<uint8_t>> ready;
+            try {
+                if (checksums_) checksums_->verify(p.header.crc, stored.data(), stored.size());
+                ready.set_value(std::move(stored));
+            } catch (...) {
+                ready.set_exception(std::current_exception());
+            }
+            p.data = ready.get_future();
+        } else {
+            std::vector<uint8_t> out;
+            if (!free_buffers_.empty()) {
+                out = std::move(free_buffers_.back());
+                free_buffers_.pop_back();
+            }
+            out.resize(static_cast<size_t>(p.header.uncompressed_page_size));
+            // Levels of DATA_PAGE_V2 pages are copied as stored, as by
+            // ParquetReader::read_page_data()
+            size_t levels = page.levels_size();
+            if (levels > stored.size() || levels > out.size()) {
+                throw std::runtime_error("Page at offset " + std::to_string(data_offset) +
+                                         " has more level bytes than data");
+            }
+            auto task = [decompress = decompress_, checksums = checksums_, crc = p.header.crc,
+                         stored = std::move(stored), out = std::move(out), levels]() mutable {
+                if (checksums) checksums->verify(crc, stored.data(), stored.size());
+                std::memcpy(out.data(), stored.data(), levels);
+                decompress(stored.data() + levels, stored.size() - levels, out.data() + levels,
+                           out.size() - levels);
+                return std::move(out);
+            };
+            if (pool_) {
+                p.data = pool_->submit(std::move(task));
+            } else {
+                std::promise<std::vector<uint8_t>> ready;
+                try {
+                    ready.set_value(task());
+                } catch (...) {
+                    ready.set_exception(std::current_exception());
+                }
+                p.data = ready.get_future();
+            }
+        }
+        pending_.push_back(std::move(p));
+    }
+}
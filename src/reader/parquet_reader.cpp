@@ -1,6 +1,9 @@
 #include "reader/parquet_reader.hpp"
+#include <algorithm>
 #include <cstring>
+#include <filesystem>
 #include <iostream>
+#include <limits>
 #include <sstream>
 
 // ── ParquetReader ────────────────────────────────────────────────────────────
@@ -12,11 +15,17 @@ ParquetReader::~ParquetReader() {
 }
 
 bool ParquetReader::open(const std::string& filename) {
+    if (file_.is_open()) file_.close();
+    file_.clear();
+    state_ = std::make_shared<ParsedFile>();
+    resolved_pages_.clear();
     file_.open(filename, std::ios::binary | std::ios::ate);
     if (!file_.is_open()) {
         std::cerr << "Error: cannot open file " << filename << std::endl;
         return false;
     }
+    path_ = filename;
+    checksums_->reset();
 
     file_size_ = static_cast<size_t>(file_.tellg());
     if (file_size_ < 12) {
@@ -24,6 +33,25 @@ bool ParquetReader::open(const std::string& filename) {
         return false;
     }
 
+    // Cache entries of this file are keyed by its identity, so a file
+    // rewritten in place misses both caches
+    std::error_code ec;
+    auto mtime = std::filesystem::last_write_time(filename, ec);
+    file_mtime_ = ec ? std::nullopt
+                     : std::optional<int64_t>(mtime.time_since_epoch().count());
+
+    // An unchanged file parsed before needs no footer I/O at all
+    std::optional<MetadataCache::Key> cache_key;
+    if (metadata_cache_ && projection_.empty()) {
+        if (file_mtime_) {
+            cache_key = MetadataCache::Key{filename, file_size_, *file_mtime_};
+            if (auto cached = metadata_cache_->find(*cache_key)) {
+                state_ = std::move(cached);
+                return true;
+            }
+        }
+    }
+
     // Read first 4 bytes (PAR1 magic)
     auto header = read_range(0, 4);
     if (std::memcmp(header.data(), "PAR1", 4) != 0) {
@@ -49,37 +77,56 @@ bool ParquetReader::open(const std::string& filename) {
     // Read and deserialize footer
     size_t footer_offset = file_size_ - 8 - footer_length;
     auto footer_data = read_range(footer_offset, footer_length);
+    // ColumnMetaData stays encoded in the footer until a chunk is used
     ThriftReader reader(footer_data.data(), footer_length);
-    metadata_.deserialize(reader);
+    auto file = std::make_shared<ParsedFile>();
+    file->metadata.deserialize(reader, true);
+    file->footer = std::move(footer_data);
+    state_ = file;
 
     // Build column info from schema
-    build_column_info();
-    build_column_index();
-    build_page_index();
+    build_column_info(*file);
+    build_column_index(*file);
+    if (!projection_.empty()) {
+        file->projected.assign(file->columns.size(), false);
+        for (const auto& name : projection_) {
+            int idx = find_column(name);
+            if (idx < 0) {
+                std::cerr << "Error: projected column not found: " << name << std::endl;
+                state_ = std::make_shared<ParsedFile>();
+                return false;
+            }
+            const ColumnInfo& col = file->columns[static_cast<size_t>(idx)];
+            file->projected[static_cast<size_t>(col.column_index)] = true;
+        }
+    }
+    build_chunk_table(*file);
+    build_page_index(*file);
 
+    if (cache_key) state_ = metadata_cache_->insert(*cache_key, file, file->memory_usage());
     return true;
 }
 
 // ── Schema inspection ────────────────────────────────────────────────────────
 
-size_t ParquetReader::num_columns() const { return columns_.size(); }
-int64_t ParquetReader::num_rows() const { return metadata_.num_rows; }
-size_t ParquetReader::num_row_groups() const { return metadata_.row_groups.size(); }
+size_t ParquetReader::num_columns() const { return state_->columns.size(); }
+int64_t ParquetReader::num_rows() const { return state_->metadata.num_rows; }
+size_t ParquetReader::num_row_groups() const { return state_->metadata.row_groups.size(); }
 
 std::vector<std::string> ParquetReader::column_names() const {
     std::vector<std::string> names;
-    names.reserve(columns_.size());
-    for (const auto& col : columns_) {
+    names.reserve(state_->columns.size());
+    for (const auto& col : state_->columns) {
         names.push_back(col.name);
     }
     return names;
 }
 
 const ColumnInfo& ParquetReader::column(size_t col_idx) const {
-    if (col_idx >= columns_.size()) {
+    if (col_idx >= state_->columns.size()) {
         throw std::runtime_error("Column index " + std::to_string(col_idx) + " out of range");
     }
-    return columns_[col_idx];
+    return state_->columns[col_idx];
 }
 
 const ColumnInfo& ParquetReader::column(const std::string& name) const {
@@ -87,20 +134,20 @@ const ColumnInfo& ParquetReader::column(const std::string& name) const {
     if (idx < 0) {
         throw std::runtime_error("Column not found: " + name);
     }
-    return columns_[static_cast<size_t>(idx)];
+    return state_->columns[static_cast<size_t>(idx)];
 }
 
 int ParquetReader::find_column(const std::string& name) const {
-    auto it = column_name_to_idx_.find(name);
-    if (it == column_name_to_idx_.end()) return -1;
+    auto it = state_->column_name_to_idx.find(name);
+    if (it == state_->column_name_to_idx.end()) return -1;
     return static_cast<int>(it->second);
 }
 
 std::string ParquetReader::schema_string() const {
     std::ostringstream ss;
     ss << "Schema:\n";
-    for (size_t i = 0; i < columns_.size(); i++) {
-        const auto& col = columns_[i];
+    for (size_t i = 0; i < state_->columns.size(); i++) {
+        const auto& col = state_->columns[i];
         ss << "  " << i << ": " << col.name
            << " (" << col.type_name();
         if (col.converted_type.has_value() && col.converted_type.value() != ConvertedType::NONE) {
@@ -115,88 +162,595 @@ std::string ParquetReader::schema_string() const {
         }
         ss << ")\n";
     }
-    ss << "Rows: " << metadata_.num_rows << "\n";
-    ss << "Row groups: " << metadata_.row_groups.size() << "\n";
+    ss << "Rows: " << state_->metadata.num_rows << "\n";
+    ss << "Row groups: " << state_->metadata.row_groups.size() << "\n";
     return ss.str();
 }
 
 // ── Column reading ───────────────────────────────────────────────────────────
 
 std::vector<Value> ParquetReader::read_column(const std::string& col_name, size_t row_group_idx) {
+    std::vector<Value> result;
+    read_column(col_name, row_group_idx, result);
+    return result;
+}
+
+std::vector<Value> ParquetReader::read_column(const std::string& col_name) {
+    std::vector<Value> result;
+    read_column(col_name, result);
+    return result;
+}
+
+std::vector<Value> ParquetReader::read_column_by_idx(int row_group_idx, int col_idx) {
+    std::vector<Value> result;
+    read_column_by_idx(row_group_idx, col_idx, result);
+    return result;
+}
+
+size_t ParquetReader::read_column(const std::string& col_name, size_t row_group_idx,
+                                  std::vector<Value>& out) {
     int col_idx = find_column(col_name);
     if (col_idx < 0) {
         throw std::runtime_error("Column not found: " + col_name);
     }
-    return read_column_by_idx(static_cast<int>(row_group_idx), col_idx);
+    out.clear();
+    return read_column_by_idx(static_cast<int>(row_group_idx), col_idx, out);
 }
 
-std::vector<Value> ParquetReader::read_column(const std::string& col_name) {
+size_t ParquetReader::read_column(const std::string& col_name, std::vector<Value>& out) {
     int col_idx = find_column(col_name);
     if (col_idx < 0) {
         throw std::runtime_error("Column not found: " + col_name);
     }
-    std::vector<Value> result;
-    for (size_t rg = 0; rg < metadata_.row_groups.size(); rg++) {
-        auto rg_values = read_column_by_idx(static_cast<int>(rg), col_idx);
-        result.insert(result.end(), rg_values.begin(), rg_values.end());
+    out.clear();
+    for (size_t rg = 0; rg < state_->metadata.row_groups.size(); rg++) {
+        read_column_by_idx(static_cast<int>(rg), col_idx, out);
     }
-    return result;
+    return out.size();
 }
 
-std::vector<Value> ParquetReader::read_column_by_idx(int row_group_idx, int col_idx) {
-    if (row_group_idx < 0 || row_group_idx >= static_cast<int>(metadata_.row_groups.size())) {
+size_t ParquetReader::read_column_by_idx(int row_group_idx, int col_idx, std::vector<Value>& out) {
+    ColumnReader reader = make_column_reader(row_group_idx, col_idx);
+    reader.set_int96_as_string(int96_as_string_);
+    reader.set_string_arena(string_arena_);
+    reader.set_scratch(&scratch_);
+    return reader.read_all(out);
+}
+
+void ParquetReader::set_int96_as_string(bool enabled) { int96_as_string_ = enabled; }
+void ParquetReader::set_string_arena(StringArena* arena) { string_arena_ = arena; }
+
+ColumnVector ParquetReader::read_column_vector(const std::string& col_name,
+                                               size_t row_group_idx) {
+    ColumnVector out;
+    read_column_vector(col_name, row_group_idx, out);
+    return out;
+}
+
+ColumnVector ParquetReader::read_column_vector(const std::string& col_name) {
+    ColumnVector out;
+    read_column_vector(col_name, out);
+    return out;
+}
+
+size_t ParquetReader::read_column_vector(const std::string& col_name, size_t row_group_idx,
+                                         ColumnVector& out) {
+    int col_idx = find_column(col_name);
+    if (col_idx < 0) {
+        throw std::runtime_error("Column not found: " + col_name);
+    }
+    out.clear();
+    return read_column_vector_by_idx(static_cast<int>(row_group_idx), col_idx, out);
+}
+
+size_t ParquetReader::read_column_vector(const std::string& col_name, ColumnVector& out) {
+    int col_idx = find_column(col_name);
+    if (col_idx < 0) {
+        throw std::runtime_error("Column not found: " + col_name);
+    }
+    out.clear();
+    for (size_t rg = 0; rg < state_->metadata.row_groups.size(); rg++) {
+        read_column_vector_by_idx(static_cast<int>(rg), col_idx, out);
+    }
+    return out.size;
+}
+
+size_t ParquetReader::read_column_vector_by_idx(int row_group_idx, int col_idx,
+                                                ColumnVector& out) {
+    ColumnReader reader = make_column_reader(row_group_idx, col_idx);
+    reader.set_scratch(&scratch_);
+    return reader.read_all(out);
+}
+
+ListVector ParquetReader::read_list_vector(const std::string& col_name, size_t row_group_idx) {
+    int col_idx = find_column(col_name);
+    if (col_idx < 0) {
+        throw std::runtime_error("Column not found: " + col_name);
+    }
+    ListVector out;
+    read_list_vector_by_idx(static_cast<int>(row_group_idx), col_idx, out);
+    return out;
+}
+
+ListVector ParquetReader::read_list_vector(const std::string& col_name) {
+    int col_idx = find_column(col_name);
+    if (col_idx < 0) {
+        throw std::runtime_error("Column not found: " + col_name);
+    }
+    ListVector out;
+    for (size_t rg = 0; rg < state_->metadata.row_groups.size(); rg++) {
+        read_list_vector_by_idx(static_cast<int>(rg), col_idx, out);
+    }
+    return out;
+}
+
+size_t ParquetReader::read_list_vector_by_idx(int row_group_idx, int col_idx, ListVector& out) {
+    if (col_idx >= 0 && col_idx < static_cast<int>(state_->columns.size()) &&
+        state_->columns[col_idx].max_rep_level == 0) {
+        throw std::runtime_error("Column '" + state_->columns[col_idx].path + "' is not repeated");
+    }
+    ColumnReader reader = make_column_reader(row_group_idx, col_idx);
+    reader.set_scratch(&scratch_);
+    return reader.read_all(out);
+}
+
+ColumnReader ParquetReader::make_column_reader(int row_group_idx, int col_idx) {
+    if (row_group_idx < 0 || row_group_idx >= static_cast<int>(state_->metadata.row_groups.size())) {
         throw std::runtime_error("Invalid row group index");
     }
-    if (col_idx < 0 || col_idx >= static_cast<int>(columns_.size())) {
+    if (col_idx < 0 || col_idx >= static_cast<int>(state_->columns.size())) {
         throw std::runtime_error("Invalid column index");
     }
 
-    const auto& col_info = columns_[col_idx];
-    const auto& rg = metadata_.row_groups[row_group_idx];
-    const auto& chunk = rg.columns[col_info.column_index];
+    const auto& col_info = state_->columns[col_idx];
+    column_chunk_meta(static_cast<size_t>(row_group_idx), static_cast<size_t>(col_info.column_index));
+    const auto& chunk = state_->metadata.row_groups[row_group_idx].columns[col_info.column_index];
 
     auto read_func = [this](size_t offset, size_t length) {
         return this->read_range(offset, length);
     };
 
-    ColumnReader reader(read_func, chunk,
-                       col_info.type, col_info.max_def_level, col_info.max_rep_level);
-    return reader.read_all();
+    ColumnReader reader(read_func, chunk, col_info);
+    if (file_mtime_) {
+        reader.set_dictionary_cache(dictionary_cache_.get(), dictionary_key(row_group_idx, col_idx));
+    }
+    reader.set_page_header_cache(&state_->page_headers,
+                                 {static_cast<size_t>(row_group_idx),
+                                  static_cast<size_t>(col_info.column_index)});
+    reader.set_page_checksums(page_checksums());
+    return reader;
+}
+
+// ── Statistics and pruning ───────────────────────────────────────────────────
+
+ColumnStatistics ParquetReader::column_statistics(const std::string& col_name,
+                                                  size_t row_group_idx) const {
+    const ColumnInfo& col = column(col_name);
+    if (row_group_idx >= state_->metadata.row_groups.size()) {
+        throw std::runtime_error("Invalid row group index");
+    }
+    const ColumnMetaData* meta = column_chunk_meta(row_group_idx, col.column_index);
+    if (!meta || !meta->statistics) return {};
+    return decode_statistics(*meta->statistics, col);
+}
+
+std::vector<size_t> ParquetReader::prune_row_groups(const std::string& col_name,
+                                                    const ColumnPredicate& predicate) const {
+    const ColumnInfo& col = column(col_name);
+    bool equality = predicate.is_equality(col);
+    std::vector<size_t> keep;
+    for (size_t rg = 0; rg < state_->metadata.row_groups.size(); rg++) {
+        const ColumnMetaData* meta = column_chunk_meta(rg, col.column_index);
+        if (meta && meta->statistics &&
+            !predicate.might_match(decode_statistics(*meta->statistics, col), col,
+                                   meta->num_values)) {
+            continue;
+        }
+        // Point lookups inside the min/max range can still miss the filter
+        if (equality && meta && meta->bloom_filter_offset) {
+            auto filter = bloom_filter(col_name, rg);
+            if (filter && !filter->might_contain(*predicate.lower, col)) continue;
+        }
+        keep.push_back(rg);
+    }
+    return keep;
+}
+
+std::optional<BloomFilter> ParquetReader::bloom_filter(const std::string& col_name,
+                                                       size_t row_group_idx) const {
+    const ColumnInfo& col = column(col_name);
+    if (row_group_idx >= state_->metadata.row_groups.size()) {
+        throw std::runtime_error("Invalid row group index");
+    }
+    const ColumnMetaData* chunk_meta = column_chunk_meta(row_group_idx, col.column_index);
+    if (!chunk_meta || !chunk_meta->bloom_filter_offset) return std::nullopt;
+    const auto& meta = *chunk_meta;
+
+    // Without a stored length, read a guess and fetch the rest of the bitset
+    size_t offset = static_cast<size_t>(*meta.bloom_filter_offset);
+    if (offset >= file_size_) {
+        throw std::runtime_error("Bloom filter of '" + col_name + "' lies outside the file");
+    }
+    size_t length = meta.bloom_filter_length ? static_cast<size_t>(*meta.bloom_filter_length)
+                                             : HEADER_READ_SIZE;
+    length = std::min(length, file_size_ - offset);
+    auto buf = read_range(offset, length);
+
+    ThriftReader reader(buf.data(), buf.size());
+    BloomFilterHeader header;
+    header.deserialize(reader);
+    if (!header.split_block || !header.xxhash || !header.uncompressed) return std::nullopt;
+    size_t header_size = reader.position();
+    size_t num_bytes = static_cast<size_t>(header.num_bytes);
+    if (header.num_bytes <= 0 || num_bytes > file_size_ - offset - header_size) {
+        throw std::runtime_error("Invalid Bloom filter size for '" + col_name + "'");
+    }
+    if (header_size + num_bytes <= buf.size()) {
+        buf.resize(header_size + num_bytes);
+        buf.erase(buf.begin(), buf.begin() + static_cast<std::ptrdiff_t>(header_size));
+    } else {
+        buf = read_range(offset + header_size, num_bytes);
+    }
+    return BloomFilter(std::move(buf));
+}
+
+// ── Page index ───────────────────────────────────────────────────────────────
+
+const OffsetIndex* ParquetReader::offset_index(const std::string& col_name,
+                                               size_t row_group_idx) const {
+    const ColumnInfo& col = column(col_name);
+    if (row_group_idx >= state_->chunk_pages.size()) {
+        throw std::runtime_error("Invalid row group index");
+    }
+    return state_->chunk_pages[row_group_idx][col.column_index].offset_index.get();
+}
+
+const ColumnIndex* ParquetReader::column_index(const std::string& col_name,
+                                               size_t row_group_idx) const {
+    const ColumnInfo& col = column(col_name);
+    if (row_group_idx >= state_->chunk_pages.size()) {
+        throw std::runtime_error("Invalid row group index");
+    }
+    return state_->chunk_pages[row_group_idx][col.column_index].column_index.get();
+}
+
+std::vector<size_t> ParquetReader::prune_pages(const std::string& col_name,
+                                               const ColumnPredicate& predicate) const {
+    const ColumnInfo& col = column(col_name);
+    if (!is_projected(col.column_index)) {
+        throw std::runtime_error("Column '" + col_name + "' is not in the projection");
+    }
+    std::vector<size_t> keep;
+    for (size_t rg : prune_row_groups(col_name, predicate)) {
+        const auto& pages = state_->chunk_pages[rg][col.column_index];
+        const ColumnIndex* index = pages.column_index.get();
+        if (index && index->null_pages.size() != pages.num_pages) index = nullptr;
+        for (size_t i = 0; i < pages.num_pages; i++) {
+            if (index) {
+                bool match;
+                if (index->null_pages[i]) {
+                    match = predicate.kind == ColumnPredicate::Kind::IS_NULL;
+                } else {
+                    // Not all null, so the page's value count does not matter
+                    match = predicate.might_match(decode_page_statistics(*index, i, col), col,
+                                                  std::numeric_limits<int64_t>::max());
+                }
+                if (!match) continue;
+            }
+            keep.push_back(pages.first_page_id + i);
+        }
+    }
+    return keep;
+}
+
+// ── Sorted lookups ───────────────────────────────────────────────────────────
+
+const std::vector<SortingColumn>& ParquetReader::sorting_columns(size_t row_group_idx) const {
+    if (row_group_idx >= state_->metadata.row_groups.size()) {
+        throw std::runtime_error("Invalid row group index");
+    }
+    return state_->metadata.row_groups[row_group_idx].sorting_columns;
+}
+
+std::optional<SortingColumn> ParquetReader::sort_order(const std::string& col_name) const {
+    const ColumnInfo& col = column(col_name);
+    std::optional<SortingColumn> order;
+    for (const auto& rg : state_->metadata.row_groups) {
+        if (rg.sorting_columns.empty() || rg.sorting_columns[0].column_idx != col.column_index) {
+            return std::nullopt;
+        }
+        const auto& key = rg.sorting_columns[0];
+        if (order && (order->descending != key.descending || order->nulls_first != key.nulls_first)) {
+            return std::nullopt;
+        }
+        order = key;
+    }
+    return order;
+}
+
+int64_t ParquetReader::lower_bound(const std::string& col_name, const Value& value) {
+    const ColumnInfo& col = column(col_name);
+    auto order = sort_order(col_name);
+    if (!order) throw std::runtime_error("Column '" + col_name + "' is not declared sorted");
+    if (col.max_rep_level > 0) {
+        throw std::runtime_error("lower_bound needs a non-repeated column: " + col_name);
+    }
+    if (value.is_null) throw std::runtime_error("lower_bound needs a non-null value");
+    const int col_idx = find_column(col_name);
+    const auto& row_groups = state_->metadata.row_groups;
+
+    // False for the rows before the bound and true from it on; nulls sort
+    // where the writer put them
+    auto reaches = [&](const Value& v) {
+        if (v.is_null) return !order->nulls_first;
+        int c = compare_values(v, value, col);
+        return order->descending ? c <= 0 : c >= 0;
+    };
+    // Whether a chunk or page with these statistics ends at or past the
+    // bound; nullopt when they have no min/max (none were written, or the
+    // values are all NaN), so its values must be read instead
+    auto stats_reach = [&](const ColumnStatistics& stats, bool all_null) -> std::optional<bool> {
+        if (!order->nulls_first && stats.null_count && *stats.null_count > 0) return true;
+        if (all_null) return !order->nulls_first;
+        if (!stats.has_min_max()) return std::nullopt;
+        return reaches(order->descending ? *stats.min : *stats.max);
+    };
+    auto first_reaching = [&](size_t count, auto&& pred) {
+        size_t lo = 0, hi = count;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (pred(mid)) hi = mid;
+            else lo = mid + 1;
+        }
+        return lo;
+    };
+    auto first_row = [&](const std::vector<Value>& values) {
+        return static_cast<int64_t>(std::partition_point(values.begin(), values.end(),
+                                                         [&](const Value& v) { return !reaches(v); }) -
+                                    values.begin());
+    };
+
+    // Row position of the bound within a row group, num_rows if past its end
+    auto search_row_group = [&](size_t rg) -> int64_t {
+        const auto& pages = state_->chunk_pages[rg][col.column_index];
+        const OffsetIndex* offsets = pages.offset_index.get();
+        const ColumnIndex* index = pages.column_index.get();
+        ColumnReader reader = make_column_reader(static_cast<int>(rg), col_idx);
+        reader.set_scratch(&scratch_);
+        std::vector<Value> values;
+        if (!offsets || !index || index->null_pages.size() != offsets->page_locations.size()) {
+            reader.read_all(values);
+            return first_row(values);
+        }
+        size_t num_pages = offsets->page_locations.size();
+        size_t page = first_reaching(num_pages, [&](size_t p) {
+            if (auto known = stats_reach(decode_page_statistics(*index, p, col),
+                                         index->null_pages[p])) {
+                return *known;
+            }
+            values.clear();
+            reader.read_page_at(static_cast<size_t>(offsets->page_locations[p].offset), values);
+            return !values.empty() && reaches(values.back());
+        });
+        // The first page reaching the bound by its statistics holds it;
+        // later pages are only read if the statistics overstate it
+        for (; page < num_pages; page++) {
+            const auto& loc = offsets->page_locations[page];
+            values.clear();
+            reader.read_page_at(static_cast<size_t>(loc.offset), values);
+            int64_t slot = first_row(values);
+            if (slot < static_cast<int64_t>(values.size())) return loc.first_row_index + slot;
+        }
+        return row_groups[rg].num_rows;
+    };
+
+    // Row groups searched so far, as a probe may have searched one already
+    std::vector<std::optional<int64_t>> searched(row_groups.size());
+    auto search = [&](size_t i) {
+        if (!searched[i]) searched[i] = search_row_group(i);
+        return *searched[i];
+    };
+    size_t rg = first_reaching(row_groups.size(), [&](size_t i) {
+        ColumnStatistics stats = column_statistics(col_name, i);
+        bool all_null = stats.null_count && *stats.null_count >= row_groups[i].num_rows;
+        if (auto known = stats_reach(stats, all_null)) return *known;
+        return search(i) < row_groups[i].num_rows;
+    });
+    const auto& first_rows = state_->row_group_first_row;
+    for (; rg < row_groups.size(); rg++) {
+        int64_t row = search(rg);
+        if (row < row_groups[rg].num_rows) return first_rows[rg] + row;
+    }
+    return first_rows.back();
+}
+
+// ── Row lookups ──────────────────────────────────────────────────────────────
+
+RowLocation ParquetReader::locate_row(const std::string& col_name, int64_t row) const {
+    const ColumnInfo& col = column(col_name);
+    if (!is_projected(col.column_index)) {
+        throw std::runtime_error("Column '" + col_name + "' is not in the projection");
+    }
+    const auto& first_rows = state_->row_group_first_row;
+    if (row < 0 || row >= first_rows.back()) {
+        throw std::runtime_error("Row " + std::to_string(row) + " out of range");
+    }
+    // Row groups without rows share their first row with the next one
+    size_t rg = static_cast<size_t>(
+        std::upper_bound(first_rows.begin(), first_rows.end(), row) - first_rows.begin() - 1);
+
+    const auto& pages = state_->chunk_pages[rg][col.column_index];
+    auto begin = state_->page_index.begin() + static_cast<std::ptrdiff_t>(pages.first_page_id);
+    auto end = begin + static_cast<std::ptrdiff_t>(pages.num_pages);
+    if (begin == end || begin->first_row < 0) {
+        throw std::runtime_error("Column '" + col_name + "' has no row positions in row group " +
+                                 std::to_string(rg) + " (repeated column without an OffsetIndex)");
+    }
+    auto page = std::upper_bound(begin, end, row, [](int64_t r, const PageIndexEntry& entry) {
+        return r < entry.first_row;
+    }) - 1;
+    return {rg, static_cast<size_t>(page - state_->page_index.begin()), row - page->first_row};
+}
+
+Value ParquetReader::read_value(const std::string& col_name, int64_t row) {
+    const ColumnInfo& col = column(col_name);
+    if (col.max_rep_level > 0) {
+        throw std::runtime_error("read_value needs a non-repeated column: " + col_name);
+    }
+    RowLocation loc = locate_row(col_name, row);
+    const auto& entry = state_->page_index[loc.page_id];
+    std::vector<Value> values;
+    ColumnReader reader = make_column_reader(static_cast<int>(loc.row_group_idx),
+                                             find_column(col_name));
+    reader.set_scratch(&scratch_);
+    reader.read_page_at(entry.page_offset, values);
+    if (loc.slot >= static_cast<int64_t>(values.size())) {
+        throw std::runtime_error("Page at offset " + std::to_string(entry.page_offset) +
+                                 " holds fewer rows than its index entry");
+    }
+    return std::move(values[static_cast<size_t>(loc.slot)]);
+}
+
+// ── Parallel decompression ───────────────────────────────────────────────────
+
+void ParquetReader::set_decompression_threads(size_t threads, size_t depth) {
+    decompression_pool_.reset();
+    if (threads == 0) {
+        prefetch_depth_ = 1;
+        return;
+    }
+    decompression_pool_ = std::make_shared<ThreadPool>(threads);
+    prefetch_depth_ = depth > 0 ? depth : 2 * threads;
+}
+
+// ── Dictionary cache ─────────────────────────────────────────────────────────
+
+DictionaryCache& ParquetReader::dictionary_cache() { return *dictionary_cache_; }
+
+void ParquetReader::set_dictionary_cache(std::shared_ptr<DictionaryCache> cache) {
+    if (!cache) throw std::runtime_error("Dictionary cache must not be null");
+    dictionary_cache_ = std::move(cache);
+}
+
+DictionaryCache::Key ParquetReader::dictionary_key(int row_group_idx, int col_idx) const {
+    return {path_, file_size_, *file_mtime_, row_group_idx, col_idx};
 }
 
 // ── Accessors ────────────────────────────────────────────────────────────────
 
-const FileMetaData& ParquetReader::metadata() const { return metadata_; }
-const std::vector<ColumnInfo>& ParquetReader::columns() const { return columns_; }
+const FileMetaData& ParquetReader::metadata() const {
+    for (size_t rg = 0; rg < state_->metadata.row_groups.size(); rg++) {
+        for (size_t col = 0; col < state_->metadata.row_groups[rg].columns.size(); col++) {
+            column_chunk_meta(rg, col);
+        }
+    }
+    return state_->metadata;
+}
+
+const ColumnMetaData* ParquetReader::column_chunk_meta(size_t row_group_idx, size_t col_idx) const {
+    auto& row_groups = state_->metadata.row_groups;
+    if (row_group_idx >= row_groups.size() || col_idx >= row_groups[row_group_idx].columns.size()) {
+        throw std::runtime_error("Invalid column chunk index");
+    }
+    // Readers sharing the file through the cache may decode concurrently
+    std::lock_guard<std::mutex> lock(state_->decode_mutex);
+    auto& chunk = row_groups[row_group_idx].columns[col_idx];
+    if (!state_->footer.empty() && !chunk.meta_data) {
+        // The first row group's chunk owns the column's path
+        const ColumnChunk* first = nullptr;
+        if (row_group_idx > 0 && col_idx < row_groups[0].columns.size()) {
+            auto& head = row_groups[0].columns[col_idx];
+            if (!head.meta_data) {
+                head.decode_meta_data(state_->footer.data());
+                state_->growth.add(state_->chunk_meta_bytes(0, col_idx));
+            }
+            first = &head;
+        }
+        chunk.decode_meta_data(state_->footer.data(), first);
+        // Charged to the metadata cache on its next access
+        state_->growth.add(state_->chunk_meta_bytes(row_group_idx, col_idx));
+    }
+    return chunk.meta_data.get();
+}
+const std::vector<ColumnInfo>& ParquetReader::columns() const { return state_->columns; }
 size_t ParquetReader::file_size() const { return file_size_; }
 
-std::vector<uint8_t> ParquetReader::read_range(size_t offset, size_t length) {
+std::vector<uint8_t> ParquetReader::read_range(size_t offset, size_t length) const {
     std::vector<uint8_t> buf(length);
+    std::lock_guard<std::mutex> lock(file_mutex_);
     file_.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
     file_.read(reinterpret_cast<char*>(buf.data()), static_cast<std::streamsize>(length));
+    // A header read near the end of a small file runs past it: the bytes
+    // beyond stay zero, and the stream is reset for the next read
+    if (!file_) file_.clear();
     return buf;
 }
 
 // ── Raw page data API ────────────────────────────────────────────────────────
 
-size_t ParquetReader::num_pages() const { return page_index_.size(); }
+size_t ParquetReader::num_pages() const { return state_->page_index.size(); }
 
 std::vector<uint8_t> ParquetReader::read_page_data(size_t global_page_id) const {
-    if (global_page_id >= page_index_.size()) {
+    if (global_page_id >= state_->page_index.size()) {
         throw std::runtime_error("Global page ID " + std::to_string(global_page_id) + " out of range");
     }
-    const auto& entry = page_index_[global_page_id];
-    // const_cast needed because read_range is non-const (seeks on ifstream)
-    auto& self = const_cast<ParquetReader&>(*this);
-    return self.read_range(entry.data_offset, entry.data_size);
+    return read_page_data_async(global_page_id, nullptr).get();
+}
+
+// Read the stored bytes of a page now and decompress them on `pool`, or
+// inline without one.
+std::future<std::vector<uint8_t>> ParquetReader::read_page_data_async(size_t global_page_id,
+                                                                      ThreadPool* pool) const {
+    const PageIndexEntry* entry = &resolved_entry(global_page_id);
+    std::vector<uint8_t> stored;
+    if (entry->header_read) {
+        stored = read_range(entry->data_offset, entry->data_size);
+    } else {
+        // Header and data in one read
+        PageIndexEntry resolved = *entry;
+        stored = read_range(resolved.page_offset, resolved.page_size);
+        parse_page_header(resolved, stored.data(), stored.size());
+        stored.erase(stored.begin(), stored.begin() + (resolved.data_offset - resolved.page_offset));
+        entry = &store_resolved(global_page_id, resolved);
+    }
+    if (auto* checksums = page_checksums()) {
+        checksums->verify(entry->crc, stored.data(), stored.size());
+    }
+
+    std::promise<std::vector<uint8_t>> ready;
+    if (entry->codec == CompressionCodec::UNCOMPRESSED || !entry->values_compressed) {
+        ready.set_value(std::move(stored));
+        return ready.get_future();
+    }
+    DecompressFunc decompress = find_decompressor(entry->codec);
+    if (!decompress) {
+        throw std::runtime_error(std::string("Compression codec ") + compression_name(entry->codec) +
+                                 " is not supported by this build");
+    }
+    // Levels of DATA_PAGE_V2 pages are copied as stored
+    size_t levels = entry->levels_size;
+    if (levels > stored.size() || levels > entry->uncompressed_size) {
+        throw std::runtime_error("Page " + std::to_string(global_page_id) +
+                                 " has more level bytes than data");
+    }
+    auto task = [decompress, stored = std::move(stored), size = entry->uncompressed_size, levels] {
+        std::vector<uint8_t> data(size);
+        std::memcpy(data.data(), stored.data(), levels);
+        decompress(stored.data() + levels, stored.size() - levels, data.data() + levels,
+                   data.size() - levels);
+        return data;
+    };
+    if (pool) return pool->submit(std::move(task));
+    ready.set_value(task());
+    return ready.get_future();
 }
 
 std::vector<uint8_t> ParquetReader::read_pages_chunk(size_t start_page_id, size_t end_page_id,
                                                       size_t max_bytes) const {
-    if (start_page_id >= page_index_.size()) {
+    if (start_page_id >= state_->page_index.size()) {
         throw std::runtime_error("Start page ID " + std::to_string(start_page_id) + " out of range");
     }
-    if (end_page_id >= page_index_.size()) {
+    if (end_page_id >= state_->page_index.size()) {
         throw std::runtime_error("End page ID " + std::to_string(end_page_id) + " out of range");
     }
     if (start_page_id > end_page_id) {
@@ -206,7 +760,7 @@ std::vector<uint8_t> ParquetReader::read_pages_chunk(size_t start_page_id, size_
     // Compute total size of all pages in range, capped at max_bytes
     size_t total_size = 0;
     for (size_t i = start_page_id; i <= end_page_id; i++) {
-        total_size += page_index_[i].data_size;
+        total_size += page_index_entry(i).payload_size();
         if (total_size >= max_bytes) {
             total_size = max_bytes;
             break;
@@ -216,59 +770,103 @@ std::vector<uint8_t> ParquetReader::read_pages_chunk(size_t start_page_id, size_
     std::vector<uint8_t> result;
     result.reserve(total_size);
 
-    auto& self = const_cast<ParquetReader&>(*this);
     for (size_t i = start_page_id; i <= end_page_id; i++) {
-        const auto& entry = page_index_[i];
+        const auto& entry = page_index_entry(i);
         size_t remaining = max_bytes - result.size();
         if (remaining == 0) break;
 
-        size_t to_read = std::min(entry.data_size, remaining);
-        auto page_data = self.read_range(entry.data_offset, to_read);
-        result.insert(result.end(), page_data.begin(), page_data.end());
+        if (entry.codec == CompressionCodec::UNCOMPRESSED && !page_checksums()) {
+            size_t to_read = std::min(entry.data_size, remaining);
+            auto page_data = read_range(entry.data_offset, to_read);
+            result.insert(result.end(), page_data.begin(), page_data.end());
+        } else {
+            // Compressed pages can only be decompressed, and checksummed, whole
+            auto page_data = read_page_data(i);
+            size_t to_copy = std::min(page_data.size(), remaining);
+            result.insert(result.end(), page_data.begin(), page_data.begin() + to_copy);
+        }
     }
 
     return result;
 }
 
 const PageIndexEntry& ParquetReader::page_index_entry(size_t global_page_id) const {
-    if (global_page_id >= page_index_.size()) {
+    if (global_page_id >= state_->page_index.size()) {
         throw std::runtime_error("Global page ID " + std::to_string(global_page_id) + " out of range");
     }
-    return page_index_[global_page_id];
+    const auto& entry = resolved_entry(global_page_id);
+    if (entry.header_read) return entry;
+    PageIndexEntry resolved = entry;
+    auto header = read_range(resolved.page_offset, std::min(resolved.page_size, HEADER_READ_SIZE));
+    parse_page_header(resolved, header.data(), header.size());
+    return store_resolved(global_page_id, resolved);
+}
+
+// The shared index entry of a page, or this reader's copy with the header
+// fields once it has read them
+const PageIndexEntry& ParquetReader::resolved_entry(size_t global_page_id) const {
+    const auto& entry = state_->page_index[global_page_id];
+    if (entry.header_read) return entry;
+    std::lock_guard<std::mutex> lock(resolve_mutex_);
+    auto it = resolved_pages_.find(global_page_id);
+    return it == resolved_pages_.end() ? entry : it->second;
+}
+
+// Record a resolved entry. When two threads resolve the same page the
+// first entry is kept, so references already handed out never change.
+const PageIndexEntry& ParquetReader::store_resolved(size_t global_page_id,
+                                                    const PageIndexEntry& resolved) const {
+    std::lock_guard<std::mutex> lock(resolve_mutex_);
+    return resolved_pages_.try_emplace(global_page_id, resolved).first->second;
 }
 
 // ── Page iterator ────────────────────────────────────────────────────────
 
 PageIterator::PageIterator(ParquetReader& reader, size_t start, size_t end)
-    : reader_(reader), start_(start), end_(end), current_(start) {}
+    : reader_(reader), start_(start), end_(end), current_(start), submitted_(start) {}
 
 bool PageIterator::has_next() const { return current_ < end_; }
 
+// Keep up to prefetch_depth() pages read and decompressing ahead of current_
+void PageIterator::fill() {
+    while (submitted_ < end_ && ahead_.size() < reader_.prefetch_depth()) {
+        ahead_.push_back(reader_.read_page_data_async(submitted_++, reader_.decompression_pool()));
+    }
+}
+
 RawPage PageIterator::next() {
     if (!has_next()) {
         throw std::runtime_error("PageIterator: no more pages");
     }
-    const auto& entry = reader_.page_index_entry(current_);
+    // Only the location is needed here; the header is read with the data
+    const auto& entry = reader_.state_->page_index[current_];
     RawPage page;
     page.page_id = current_;
     page.row_group_idx = entry.row_group_idx;
     page.column_idx = entry.column_idx;
-    page.data = reader_.read_page_data(current_);
+    fill();
+    page.data = ahead_.front().get();
+    ahead_.pop_front();
     current_++;
+    if (reader_.decompression_pool()) fill();
     return page;
 }
 
-void PageIterator::reset() { current_ = start_; }
+void PageIterator::reset() {
+    current_ = start_;
+    submitted_ = start_;
+    ahead_.clear();
+}
 
 PageIterator ParquetReader::page_iterator() {
-    return PageIterator(*this, 0, page_index_.size());
+    return PageIterator(*this, 0, state_->page_index.size());
 }
 
 PageIterator ParquetReader::page_iterator(size_t start_page_id, size_t end_page_id) {
-    if (start_page_id > page_index_.size()) {
+    if (start_page_id > state_->page_index.size()) {
         throw std::runtime_error("start_page_id out of range");
     }
-    if (end_page_id > page_index_.size()) {
+    if (end_page_id > state_->page_index.size()) {
         throw std::runtime_error("end_page_id out of range");
     }
     if (start_page_id > end_page_id) {
@@ -284,7 +882,7 @@ StringColumnIterator ParquetReader::column_iterator(const std::string& col_name)
     if (col_idx < 0) {
         throw std::runtime_error("Column not found: " + col_name);
     }
-    const auto& col_info = columns_[col_idx];
+    const auto& col_info = state_->columns[col_idx];
     if (col_info.type != ParquetType::BYTE_ARRAY) {
         throw std::runtime_error("Column '" + col_name +
             "' is not BYTE_ARRAY (type: " + parquet_type_name(col_info.type) + ")");
@@ -295,8 +893,8 @@ StringColumnIterator ParquetReader::column_iterator(const std::string& col_name)
 StringColumnIterator::StringColumnIterator(ParquetReader& reader, size_t col_idx)
     : reader_(reader), col_idx_(col_idx),
       rg_idx_(0), num_row_groups_(reader.num_row_groups()),
-      cur_offset_(0), values_read_(0), total_values_(0),
-      has_dict_(false), row_group_base_(0), string_idx_(0),
+      values_read_(0), rows_read_(0), total_values_(0),
+      row_group_base_(0), string_idx_(0),
       max_def_level_(reader.columns()[col_idx].max_def_level),
       max_rep_level_(reader.columns()[col_idx].max_rep_level) {
     if (num_row_groups_ > 0) {
@@ -306,25 +904,34 @@ StringColumnIterator::StringColumnIterator(ParquetReader& reader, size_t col_idx
 }
 
 void StringColumnIterator::init_row_group() {
-    const auto& rg = reader_.metadata().row_groups[rg_idx_];
     const auto& col_info = reader_.columns()[col_idx_];
-    const auto& chunk = rg.columns[col_info.column_index];
-    const auto& meta = chunk.meta_data.value();
+    const ColumnMetaData* chunk_meta = reader_.column_chunk_meta(rg_idx_, col_info.column_index);
+    if (!chunk_meta) throw std::runtime_error("ColumnChunk has no metadata");
+    const auto& meta = *chunk_meta;
 
-    int64_t offset = meta.data_page_offset;
-    if (meta.dictionary_page_offset.has_value()) {
-        offset = std::min(offset, *meta.dictionary_page_offset);
-    }
-
-    cur_offset_ = static_cast<size_t>(offset);
+    auto read_func = [&reader = reader_](size_t offset, size_t length) {
+        return reader.read_range(offset, length);
+    };
+    pipeline_ = std::make_unique<PagePipeline>(read_func, meta, reader_.decompression_pool_,
+                                               reader_.prefetch_depth(), reader_.page_checksums());
+    pipeline_->set_page_header_cache(&reader_.state_->page_headers,
+                                     {rg_idx_, static_cast<size_t>(col_info.column_index)});
     values_read_ = 0;
+    rows_read_ = 0;
+    row_group_base_ = static_cast<size_t>(reader_.state_->row_group_first_row[rg_idx_]);
     total_values_ = meta.num_values;
-    has_dict_ = false;
-    dictionary_.clear();
+
+    // A dictionary another scan decoded needs no page read at all
+    dictionary_.reset();
+    if (reader_.file_mtime_) {
+        dictionary_ = reader_.dictionary_cache().find_vector(
+            reader_.dictionary_key(static_cast<int>(rg_idx_), static_cast<int>(col_idx_)));
+        if (dictionary_) pipeline_->skip_dictionary_page();
+    }
 }
 
 bool StringColumnIterator::has_next() const {
-    return string_idx_ < page_strings_.size();
+    return string_idx_ < page_values_.size();
 }
 
 std::tuple<size_t, size_t, const char*> StringColumnIterator::next() {
@@ -333,31 +940,54 @@ std::tuple<size_t, size_t, const char*> StringColumnIterator::next() {
     }
 
     size_t pos = page_positions_[string_idx_];
-    const auto& str = page_strings_[string_idx_];
-    std::tuple<size_t, size_t, const char*> result{pos, str.size(), str.data()};
+    std::tuple<size_t, size_t, const char*> result{
+        pos, page_values_.length(string_idx_), page_values_.ptr(string_idx_)};
     string_idx_++;
 
-    if (string_idx_ >= page_strings_.size()) {
+    if (string_idx_ >= page_values_.size()) {
         decode_next_page();
     }
 
     return result;
 }
 
+// Shares the typed dictionary ColumnReader caches for the same chunk; the
+// page is only decoded when no scan has cached it yet.
+void StringColumnIterator::load_dictionary(const PagePipeline::Page& page) {
+    DictionaryCache& cache = reader_.dictionary_cache();
+    std::optional<DictionaryCache::Key> key;
+    if (reader_.file_mtime_) {
+        key = reader_.dictionary_key(static_cast<int>(rg_idx_), static_cast<int>(col_idx_));
+        dictionary_ = cache.find_vector(*key);
+        if (dictionary_) return;
+    }
+
+    ByteBuffer buf(page.data.data(), page.data.size());
+    auto& dph = page.header.dictionary_page_header.value();
+    ColumnVector dict;
+    dict.type = VectorType::BYTE_ARRAY;
+    dict.size = static_cast<size_t>(dph.num_values);
+    for (int32_t i = 0; i < dph.num_values; i++) {
+        uint32_t len = buf.read<uint32_t>();
+        dict.strings.append(reinterpret_cast<const char*>(buf.read_bytes(len)), len);
+    }
+    dictionary_ = key ? cache.store_vector(*key, std::move(dict))
+                      : std::make_shared<const ColumnVector>(std::move(dict));
+}
+
 bool StringColumnIterator::decode_next_page() {
-    page_strings_.clear();
+    std::swap(page_values_, prev_page_values_);
+    page_values_.clear();
     page_positions_.clear();
     string_idx_ = 0;
 
-    while (page_strings_.empty()) {
+    while (page_values_.empty()) {
         // Advance to next row group if current one is exhausted
         if (values_read_ >= total_values_) {
-            row_group_base_ += reader_.metadata().row_groups[rg_idx_].num_rows;
             rg_idx_++;
             while (rg_idx_ < num_row_groups_) {
                 init_row_group();
                 if (total_values_ > 0) break;
-                row_group_base_ += reader_.metadata().row_groups[rg_idx_].num_rows;
                 rg_idx_++;
             }
             if (rg_idx_ >= num_row_groups_) {
@@ -365,38 +995,46 @@ bool StringColumnIterator::decode_next_page() {
             }
         }
 
-        // Read page header
-        static constexpr size_t HEADER_READ_SIZE = 256;
-        auto header_buf = reader_.read_range(cur_offset_, HEADER_READ_SIZE);
-        ThriftReader header_reader(header_buf.data(), header_buf.size());
-        PageHeader page_header;
-        page_header.deserialize(header_reader);
-        size_t header_size = header_reader.position();
-        cur_offset_ += header_size;
-
-        int32_t page_size = page_header.compressed_page_size;
-        auto page_buf = reader_.read_range(cur_offset_, static_cast<size_t>(page_size));
+        if (!pipeline_->next(page_)) {
+            throw std::runtime_error("StringColumnIterator: column chunk ended before its values");
+        }
+        const PageHeader& page_header = page_.header;
 
         if (page_header.type == PageType::DICTIONARY_PAGE) {
-            auto& dph = page_header.dictionary_page_header.value();
-            ByteBuffer buf(page_buf.data(), page_buf.size());
-            dictionary_.clear();
-            dictionary_.reserve(dph.num_values);
-            for (int32_t i = 0; i < dph.num_values; i++) {
-                uint32_t len = buf.read<uint32_t>();
-                const uint8_t* ptr = buf.read_bytes(len);
-                dictionary_.emplace_back(reinterpret_cast<const char*>(ptr), len);
-            }
-            has_dict_ = true;
-            cur_offset_ += page_size;
+            if (!dictionary_) load_dictionary(page_);
             continue;
         }
+        if (page_header.type == PageType::DATA_PAGE_V2) {
+            throw std::runtime_error("StringColumnIterator: DATA_PAGE_V2 pages cannot be decoded");
+        }
 
         if (page_header.type == PageType::DATA_PAGE) {
             auto& dph = page_header.data_page_header.value();
             int32_t num_values = dph.num_values;
-            size_t base_pos = row_group_base_ + static_cast<size_t>(values_read_);
-            ByteBuffer buf(page_buf.data(), page_buf.size());
+            ByteBuffer buf(page_.data.data(), page_.data.size());
+
+            // Row position of each level entry. For repeated columns a new
+            // row starts at every repetition level of 0; rows_read_ carries
+            // across pages, so a page opening with the rest of a list stays
+            // in that list's row. A chunk must open with a new row, but if
+            // it does not, its leading entries go to its first row.
+            std::vector<size_t> entry_rows(num_values);
+            if (max_rep_level_ > 0) {
+                std::vector<int16_t> rep_levels(num_values);
+                uint32_t rep_len = buf.read<uint32_t>();
+                RleDecoder rep_decoder(buf.current(), rep_len, bit_width(max_rep_level_));
+                rep_decoder.get_batch(rep_levels.data(), num_values);
+                buf.read_bytes(rep_len);
+                for (int32_t i = 0; i < num_values; i++) {
+                    rows_read_ += rep_levels[i] == 0 || rows_read_ == 0;
+                    entry_rows[i] = row_group_base_ + rows_read_ - 1;
+                }
+            } else {
+                for (int32_t i = 0; i < num_values; i++) {
+                    entry_rows[i] = row_group_base_ + rows_read_ + i;
+                }
+                rows_read_ += num_values;
+            }
 
             // Read definition levels
             std::vector<int16_t> def_levels(num_values, max_def_level_);
@@ -407,12 +1045,6 @@ bool StringColumnIterator::decode_next_page() {
                 buf.read_bytes(def_len);
             }
 
-            // Skip repetition levels
-            if (max_rep_level_ > 0) {
-                uint32_t rep_len = buf.read<uint32_t>();
-                buf.read_bytes(rep_len);
-            }
-
             // Count non-null values
             int32_t num_non_null = 0;
             for (int32_t i = 0; i < num_values; i++) {
@@ -422,7 +1054,7 @@ bool StringColumnIterator::decode_next_page() {
             bool use_dict = (dph.encoding == Encoding::PLAIN_DICTIONARY ||
                              dph.encoding == Encoding::RLE_DICTIONARY);
 
-            if (use_dict && has_dict_) {
+            if (use_dict && dictionary_) {
                 uint8_t bw = buf.read_byte();
                 RleDecoder idx_decoder(buf.current(),
                     static_cast<uint32_t>(buf.remaining()), bw);
@@ -433,32 +1065,43 @@ bool StringColumnIterator::decode_next_page() {
                 for (int32_t i = 0; i < num_values; i++) {
                     if (def_levels[i] == max_def_level_) {
                         int32_t idx = indices[idx_pos++];
-                        if (idx >= 0 && idx < static_cast<int32_t>(dictionary_.size())) {
-                            page_strings_.push_back(dictionary_[idx]);
-                            page_positions_.push_back(base_pos + i);
+                        if (idx >= 0 && static_cast<size_t>(idx) < dictionary_->size) {
+                            page_values_.append(dictionary_->strings.ptr(idx),
+                                                dictionary_->strings.length(idx));
+                            page_positions_.push_back(entry_rows[i]);
                         }
                     }
                 }
+            } else if (dph.encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY ||
+                       dph.encoding == Encoding::DELTA_BYTE_ARRAY) {
+                uint32_t remaining = static_cast<uint32_t>(buf.remaining());
+                if (dph.encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+                    DeltaLengthByteArrayDecoder decoder(buf.current(), remaining);
+                    decoder.decode(page_values_, static_cast<uint32_t>(num_non_null));
+                } else {
+                    DeltaByteArrayDecoder decoder(buf.current(), remaining);
+                    decoder.decode(page_values_, static_cast<uint32_t>(num_non_null));
+                }
+                for (int32_t i = 0; i < num_values; i++) {
+                    if (def_levels[i] == max_def_level_) {
+                        page_positions_.push_back(entry_rows[i]);
+                    }
+                }
             } else {
                 // PLAIN encoding
                 for (int32_t i = 0; i < num_values; i++) {
                     if (def_levels[i] == max_def_level_) {
                         uint32_t len = buf.read<uint32_t>();
                         const uint8_t* ptr = buf.read_bytes(len);
-                        page_strings_.emplace_back(
-                            reinterpret_cast<const char*>(ptr), len);
-                        page_positions_.push_back(base_pos + i);
+                        page_values_.append(reinterpret_cast<const char*>(ptr), len);
+                        page_positions_.push_back(entry_rows[i]);
                     }
                 }
             }
 
             values_read_ += dph.num_values;
-            cur_offset_ += page_size;
-            continue;
         }
-
-        // Unknown page type - skip
-        cur_offset_ += page_size;
+        // Other page types are skipped
     }
 
     return true;
@@ -474,31 +1117,41 @@ uint8_t StringColumnIterator::bit_width(int16_t max_level) {
 
 // ── Private helpers ──────────────────────────────────────────────────────────
 
-void ParquetReader::build_column_index() {
-    column_name_to_idx_.clear();
-    for (size_t i = 0; i < columns_.size(); i++) {
-        column_name_to_idx_[columns_[i].name] = i;
+void ParquetReader::build_column_index(ParsedFile& file) {
+    file.column_name_to_idx.clear();
+    for (size_t i = 0; i < file.columns.size(); i++) {
+        file.column_name_to_idx[file.columns[i].name] = i;
+    }
+    // Dotted paths disambiguate nested leaves that share a name (e.g. "element")
+    for (size_t i = 0; i < file.columns.size(); i++) {
+        if (file.columns[i].path != file.columns[i].name) {
+            file.column_name_to_idx.emplace(file.columns[i].path, i);
+        }
     }
 }
 
-void ParquetReader::build_column_info() {
-    columns_.clear();
-    if (metadata_.schema.empty()) return;
+void ParquetReader::build_column_info(ParsedFile& file) {
+    file.columns.clear();
+    if (file.metadata.schema.empty()) return;
 
     int col_index = 0;
     int16_t def_level = 0;
     int16_t rep_level = 0;
-    build_columns_recursive(1, static_cast<int>(metadata_.schema.size()),
-                            def_level, rep_level, col_index);
+    std::vector<int16_t> repeated_def_levels;
+    build_columns_recursive(file, 1, static_cast<int>(file.metadata.schema.size()),
+                            def_level, rep_level, repeated_def_levels, "", col_index);
 }
 
-void ParquetReader::build_columns_recursive(int schema_idx, int schema_end,
+void ParquetReader::build_columns_recursive(ParsedFile& file, int schema_idx, int schema_end,
                                              int16_t def_level, int16_t rep_level,
+                                             std::vector<int16_t>& repeated_def_levels,
+                                             const std::string& path_prefix,
                                              int& col_index) {
     while (schema_idx < schema_end) {
-        const auto& elem = metadata_.schema[schema_idx];
+        const auto& elem = file.metadata.schema[schema_idx];
         int16_t my_def = def_level;
         int16_t my_rep = rep_level;
+        bool repeated = false;
 
         if (elem.repetition_type.has_value()) {
             if (elem.repetition_type.value() == FieldRepetitionType::OPTIONAL) {
@@ -506,8 +1159,11 @@ void ParquetReader::build_columns_recursive(int schema_idx, int schema_end,
             } else if (elem.repetition_type.value() == FieldRepetitionType::REPEATED) {
                 my_def++;
                 my_rep++;
+                repeated = true;
             }
         }
+        if (repeated) repeated_def_levels.push_back(my_def);
+        std::string path = path_prefix.empty() ? elem.name : path_prefix + "." + elem.name;
 
         if (elem.num_children.has_value() && elem.num_children.value() > 0) {
             int children = elem.num_children.value();
@@ -517,38 +1173,45 @@ void ParquetReader::build_columns_recursive(int schema_idx, int schema_end,
             int idx = schema_idx;
             while (remaining > 0 && idx < schema_end) {
                 remaining--;
-                if (metadata_.schema[idx].num_children.has_value() &&
-                    metadata_.schema[idx].num_children.value() > 0) {
-                    idx = skip_schema_subtree(idx);
+                if (file.metadata.schema[idx].num_children.has_value() &&
+                    file.metadata.schema[idx].num_children.value() > 0) {
+                    idx = skip_schema_subtree(file, idx);
                 } else {
                     idx++;
                 }
             }
             child_end = idx;
-            build_columns_recursive(schema_idx, child_end, my_def, my_rep, col_index);
+            build_columns_recursive(file, schema_idx, child_end, my_def, my_rep,
+                                    repeated_def_levels, path, col_index);
             schema_idx = child_end;
         } else {
             ColumnInfo info;
             info.name = elem.name;
+            info.path = path;
             info.type = elem.type.value_or(ParquetType::BYTE_ARRAY);
             info.column_index = col_index++;
             info.max_def_level = my_def;
             info.max_rep_level = my_rep;
             info.repetition = elem.repetition_type;
             info.converted_type = elem.converted_type;
-            columns_.push_back(info);
+            info.type_length = elem.type_length;
+            info.scale = elem.scale;
+            info.precision = elem.precision;
+            info.repeated_def_levels = repeated_def_levels;
+            file.columns.push_back(info);
             schema_idx++;
         }
+        if (repeated) repeated_def_levels.pop_back();
     }
 }
 
-int ParquetReader::skip_schema_subtree(int idx) {
-    int children = metadata_.schema[idx].num_children.value_or(0);
+int ParquetReader::skip_schema_subtree(const ParsedFile& file, int idx) {
+    int children = file.metadata.schema[idx].num_children.value_or(0);
     idx++;
     for (int i = 0; i < children; i++) {
-        if (metadata_.schema[idx].num_children.has_value() &&
-            metadata_.schema[idx].num_children.value() > 0) {
-            idx = skip_schema_subtree(idx);
+        if (file.metadata.schema[idx].num_children.has_value() &&
+            file.metadata.schema[idx].num_children.value() > 0) {
+            idx = skip_schema_subtree(file, idx);
         } else {
             idx++;
         }
@@ -556,50 +1219,176 @@ int ParquetReader::skip_schema_subtree(int idx) {
     return idx;
 }
 
-void ParquetReader::build_page_index() {
-    page_index_.clear();
-    static constexpr size_t HEADER_READ_SIZE = 256;
+void ParquetReader::build_chunk_table(ParsedFile& file) {
+    const auto& row_groups = file.metadata.row_groups;
+    file.chunks.resize(row_groups.size(), file.columns.size());
+    for (size_t col_idx = 0; col_idx < file.columns.size(); col_idx++) {
+        if (!is_projected(col_idx)) continue;
+        for (size_t rg_idx = 0; rg_idx < row_groups.size(); rg_idx++) {
+            if (col_idx >= row_groups[rg_idx].columns.size()) continue;
+            file.chunks.assign(rg_idx, col_idx, row_groups[rg_idx].columns[col_idx],
+                               file.footer.data());
+        }
+    }
+}
 
-    for (size_t rg_idx = 0; rg_idx < metadata_.row_groups.size(); rg_idx++) {
-        const auto& rg = metadata_.row_groups[rg_idx];
-        for (size_t col_idx = 0; col_idx < rg.columns.size(); col_idx++) {
-            const auto& chunk = rg.columns[col_idx];
-            if (!chunk.meta_data.has_value()) continue;
-            const auto& meta = chunk.meta_data.value();
+void ParquetReader::build_page_index(ParsedFile& file) {
+    file.page_index.clear();
+    file.chunk_pages.clear();
+    file.chunk_pages.resize(file.metadata.row_groups.size());
+    file.row_group_first_row.assign(1, 0);
+    for (const auto& rg : file.metadata.row_groups) {
+        file.row_group_first_row.push_back(file.row_group_first_row.back() + rg.num_rows);
+    }
+
+    for (size_t rg_idx = 0; rg_idx < file.metadata.row_groups.size(); rg_idx++) {
+        const auto& rg = file.metadata.row_groups[rg_idx];
+        file.chunk_pages[rg_idx].resize(rg.columns.size());
+        read_chunk_indexes(file, rg_idx);
 
-            int64_t offset = meta.data_page_offset;
-            if (meta.dictionary_page_offset.has_value()) {
-                offset = std::min(offset, *meta.dictionary_page_offset);
+        for (size_t col_idx = 0; col_idx < rg.columns.size(); col_idx++) {
+            auto& pages = file.chunk_pages[rg_idx][col_idx];
+            pages.first_page_id = file.page_index.size();
+            if (col_idx >= file.chunks.num_columns || !is_projected(col_idx)) continue;
+            size_t chunk = file.chunks.index(rg_idx, col_idx);
+            CompressionCodec codec = file.chunks.codec[chunk];
+            int64_t rg_first_row = file.row_group_first_row[rg_idx];
+
+            // Page locations from the OffsetIndex: no page header I/O
+            if (pages.offset_index) {
+                for (const auto& loc : pages.offset_index->page_locations) {
+                    PageIndexEntry entry{};
+                    entry.row_group_idx = rg_idx;
+                    entry.column_idx = col_idx;
+                    entry.codec = codec;
+                    entry.page_offset = static_cast<size_t>(loc.offset);
+                    entry.page_size = static_cast<size_t>(loc.compressed_page_size);
+                    entry.first_row = rg_first_row + loc.first_row_index;
+                    entry.header_read = false;
+                    file.page_index.push_back(entry);
+                }
+                pages.num_pages = file.page_index.size() - pages.first_page_id;
+                continue;
             }
 
-            size_t cur_offset = static_cast<size_t>(offset);
+            // Otherwise walk the page headers, recording them so scans of
+            // the chunk need not decode them again
+            size_t cur_offset = static_cast<size_t>(file.chunks.start_offset(chunk));
+            int64_t num_values = file.chunks.num_values[chunk];
             int64_t values_read = 0;
+            std::vector<CachedPageHeader> headers;
+            // Each value of a non-repeated column is one row
+            bool rows_known = col_idx < file.columns.size() && file.columns[col_idx].max_rep_level == 0;
 
-            while (values_read < meta.num_values) {
+            while (values_read < num_values) {
                 auto header_buf = read_range(cur_offset, HEADER_READ_SIZE);
                 ThriftReader header_reader(header_buf.data(), header_buf.size());
                 PageHeader page_header;
-                page_header.deserialize(header_reader);
-                size_t header_size = header_reader.position();
-                cur_offset += header_size;
-
-                int32_t page_size = page_header.compressed_page_size;
-
-                if (page_header.type == PageType::DATA_PAGE ||
-                    page_header.type == PageType::DATA_PAGE_V2) {
-                    page_index_.push_back({cur_offset, static_cast<size_t>(page_size),
-                                           rg_idx, col_idx});
-                    int32_t num_values = 0;
-                    if (page_header.type == PageType::DATA_PAGE &&
-                        page_header.data_page_header.has_value()) {
-                        num_values = page_header.data_page_header->num_values;
-                    }
-                    values_read += num_values;
+                page_header.deserialize(header_reader, /*skip_statistics=*/true);
+                const CachedPageHeader& page =
+                    headers.emplace_back(CachedPageHeader::from(page_header, cur_offset,
+                                                                header_reader.position()));
+
+                if (page.type == PageType::DATA_PAGE || page.type == PageType::DATA_PAGE_V2) {
+                    file.page_index.push_back({page.data_offset(),
+                                               static_cast<size_t>(page.compressed_page_size),
+                                               rg_idx, col_idx,
+                                               static_cast<size_t>(page.uncompressed_page_size),
+                                               codec, page_header.crc, page.offset,
+                                               page.end_offset() - page.offset,
+                                               rows_known ? rg_first_row + values_read : -1});
+                    file.page_index.back().levels_size = page.levels_size();
+                    file.page_index.back().values_compressed =
+                        !(page.flags & CachedPageHeader::VALUES_UNCOMPRESSED);
+                    values_read += page.data_values();
                 }
                 // Dictionary pages and other types: skip without assigning a global ID
 
-                cur_offset += page_size;
+                cur_offset = page.end_offset();
             }
+            file.page_headers.store({rg_idx, col_idx}, std::move(headers));
+            pages.num_pages = file.page_index.size() - pages.first_page_id;
         }
     }
 }
+
+// Read the OffsetIndex and ColumnIndex of every chunk in a row group. The
+// structures of one row group usually sit close together, so nearby ranges
+// are merged and fetched with a single read.
+void ParquetReader::read_chunk_indexes(ParsedFile& file, size_t row_group_idx) {
+    static constexpr size_t MAX_GAP = 64 * KB;
+
+    struct Range {
+        size_t offset;
+        size_t length;
+        size_t col_idx;
+        bool is_offset_index;
+    };
+    std::vector<Range> ranges;
+    const auto& rg = file.metadata.row_groups[row_group_idx];
+    for (size_t col_idx = 0; col_idx < rg.columns.size(); col_idx++) {
+        if (!is_projected(col_idx)) continue;
+        const auto& chunk = rg.columns[col_idx];
+        auto add = [&](const std::optional<int64_t>& offset, const std::optional<int32_t>& length,
+                       bool is_offset_index) {
+            if (!offset || !length || *offset < 0 || *length <= 0) return;
+            if (static_cast<size_t>(*offset) + static_cast<size_t>(*length) > file_size_) {
+                throw std::runtime_error("Page index of row group " + std::to_string(row_group_idx) +
+                                         " lies outside the file");
+            }
+            ranges.push_back({static_cast<size_t>(*offset), static_cast<size_t>(*length), col_idx,
+                              is_offset_index});
+        };
+        add(chunk.offset_index_offset, chunk.offset_index_length, true);
+        add(chunk.column_index_offset, chunk.column_index_length, false);
+    }
+    std::sort(ranges.begin(), ranges.end(),
+              [](const Range& a, const Range& b) { return a.offset < b.offset; });
+
+    for (size_t first = 0; first < ranges.size();) {
+        size_t begin = ranges[first].offset;
+        size_t end = begin + ranges[first].length;
+        size_t last = first + 1;
+        while (last < ranges.size() && ranges[last].offset <= end + MAX_GAP) {
+            end = std::max(end, ranges[last].offset + ranges[last].length);
+            last++;
+        }
+        auto buf = read_range(begin, end - begin);
+        for (size_t i = first; i < last; i++) {
+            const Range& r = ranges[i];
+            ThriftReader reader(buf.data() + (r.offset - begin), r.length);
+            auto& pages = file.chunk_pages[row_group_idx][r.col_idx];
+            if (r.is_offset_index) {
+                pages.offset_index = std::make_unique<OffsetIndex>();
+                pages.offset_index->deserialize(reader);
+            } else {
+                pages.column_index = std::make_unique<ColumnIndex>();
+                pages.column_index->deserialize(reader);
+            }
+        }
+        first = last;
+    }
+}
+
+// Fill the header-derived fields of `entry` from the start of its page.
+void ParquetReader::parse_page_header(PageIndexEntry& entry, const uint8_t* data,
+                                      size_t size) const {
+    ThriftReader reader(data, size);
+    PageHeader header;
+    header.deserialize(reader, /*skip_statistics=*/true);
+    size_t header_size = reader.position();
+    if (header_size + static_cast<size_t>(header.compressed_page_size) != entry.page_size) {
+        throw std::runtime_error("Page at offset " + std::to_string(entry.page_offset) +
+                                 " does not match its OffsetIndex entry");
+    }
+    entry.data_offset = entry.page_offset + header_size;
+    entry.data_size = static_cast<size_t>(header.compressed_page_size);
+    entry.uncompressed_size = static_cast<size_t>(header.uncompressed_page_size);
+    entry.crc = header.crc;
+    if (const auto& v2 = header.data_page_header_v2) {
+        entry.levels_size = static_cast<size_t>(v2->definition_levels_byte_length) +
+                            static_cast<size_t>(v2->repetition_levels_byte_length);
+        entry.values_compressed = v2->is_compressed;
+    }
+    entry.header_read = true;
+}
@@ -0,0 +1,117 @@
+#include "reader/record_batch_reader.hpp"
+
+RecordBatchReader::RecordBatchReader(ParquetReader& reader,
+                                     const std::vector<std::string>& columns,
+                                     size_t batch_size)
+    : reader_(reader), names_(columns), batch_size_(batch_size) {
+    if (batch_size_ == 0) {
+        throw std::runtime_error("Batch size must be positive");
+    }
+    for (const auto& name : columns) {
+        int col_idx = reader_.find_column(name);
+        if (col_idx < 0) {
+            throw std::runtime_error("Column not found: " + name);
+        }
+        if (reader_.columns()[col_idx].max_rep_level > 0) {
+            throw std::runtime_error("Column '" + name + "' is repeated; use read_list_vector()");
+        }
+        fields_.push_back(&reader_.columns()[col_idx]);
+        ColumnState state;
+        state.col_idx = static_cast<size_t>(col_idx);
+        columns_.push_back(std::move(state));
+    }
+    std::vector<size_t> all(reader_.num_row_groups());
+    for (size_t rg = 0; rg < all.size(); rg++) all[rg] = rg;
+    set_row_groups(std::move(all));
+}
+
+void RecordBatchReader::set_row_groups(std::vector<size_t> row_groups) {
+    total_rows_ = 0;
+    for (size_t rg : row_groups) {
+        if (rg >= reader_.num_row_groups()) {
+            throw std::runtime_error("Invalid row group index " + std::to_string(rg));
+        }
+        total_rows_ += reader_.state_->metadata.row_groups[rg].num_rows;
+    }
+    row_groups_ = std::move(row_groups);
+    reset();
+}
+
+void RecordBatchReader::reset() {
+    for (auto& col : columns_) {
+        col.chunk = 0;
+        col.reader.reset();
+        col.pending.clear();
+        col.consumed = 0;
+    }
+    rows_read_ = 0;
+}
+
+// Move `col` to the next row group that has pages left. Returns false once
+// the column's last chunk has been read.
+bool RecordBatchReader::open_next_chunk(ColumnState& col) {
+    if (col.reader) {
+        if (col.reader->has_next_page()) return true;
+        col.reader.reset();
+        col.chunk++;
+    }
+    for (; col.chunk < row_groups_.size(); col.chunk++) {
+        col.reader.emplace(reader_.make_column_reader(static_cast<int>(row_groups_[col.chunk]),
+                                                      static_cast<int>(col.col_idx)));
+        if (col.reader->has_next_page()) return true;
+    }
+    col.reader.reset();
+    return false;
+}
+
+void RecordBatchReader::decode_page(ColumnState& col) {
+    // Drop rows already handed out before the buffer grows again
+    if (col.consumed > 0) {
+        col.spare.clear();
+        if (col.available() > 0) append_range(col.spare, col.pending, col.consumed, col.available());
+        std::swap(col.pending, col.spare);
+        col.consumed = 0;
+    }
+    col.reader->read_next_page(col.pending);
+}
+
+bool RecordBatchReader::next(RecordBatch& batch) {
+    int64_t remaining = total_rows_ - rows_read_;
+    size_t rows = static_cast<size_t>(std::min<int64_t>(remaining, static_cast<int64_t>(batch_size_)));
+
+    batch.names = names_;
+    batch.fields = fields_;
+    batch.columns.resize(columns_.size());
+    for (auto& c : batch.columns) c.clear();
+    batch.num_rows = 0;
+    if (rows == 0 || columns_.empty()) return false;
+
+    // Read pages until every column has `rows` rows buffered, always taking
+    // the pending page with the lowest file offset next.
+    for (;;) {
+        ColumnState* next_col = nullptr;
+        for (auto& col : columns_) {
+            if (col.available() >= rows || !open_next_chunk(col)) continue;
+            if (!next_col || col.reader->next_page_offset() < next_col->reader->next_page_offset()) {
+                next_col = &col;
+            }
+        }
+        if (!next_col) break;
+        decode_page(*next_col);
+    }
+
+    for (auto& col : columns_) {
+        if (col.available() < rows) {
+            throw std::runtime_error("Column '" + reader_.columns()[col.col_idx].path +
+                "' has fewer rows than its row groups");
+        }
+    }
+    for (size_t i = 0; i < columns_.size(); i++) {
+        auto& col = columns_[i];
+        append_range(batch.columns[i], col.pending, col.consumed, rows);
+        col.consumed += rows;
+    }
+    batch.num_rows = rows;
+    rows_read_ += static_cast<int64_t>(rows);
+    return true;
+}
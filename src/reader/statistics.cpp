@@ -0,0 +1,214 @@
+#include "reader/statistics.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+bool is_unsigned(const ColumnInfo& col) {
+    if (!col.converted_type.has_value()) return false;
+    switch (*col.converted_type) {
+        case ConvertedType::UINT_8:
+        case ConvertedType::UINT_16:
+        case ConvertedType::UINT_32:
+        case ConvertedType::UINT_64:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Types whose deprecated min / max (signed comparison) are still correct
+bool has_signed_order(const ColumnInfo& col) {
+    switch (col.type) {
+        case ParquetType::BOOLEAN:
+        case ParquetType::FLOAT:
+        case ParquetType::DOUBLE:
+            return true;
+        case ParquetType::INT32:
+        case ParquetType::INT64:
+            return !is_unsigned(col);
+        default:
+            return false;
+    }
+}
+
+template <typename T>
+std::optional<T> load(const std::string& bytes) {
+    if (bytes.size() != sizeof(T)) return std::nullopt;
+    T v;
+    std::memcpy(&v, bytes.data(), sizeof(T));
+    return v;
+}
+
+std::optional<Value> decode_bound(const std::string& bytes, const ColumnInfo& col) {
+    switch (col.type) {
+        case ParquetType::BOOLEAN:
+            if (bytes.empty()) return std::nullopt;
+            return Value::from_bool(bytes[0] != 0);
+        case ParquetType::INT32:
+            if (auto v = load<int32_t>(bytes)) return Value::from_i32(*v);
+            return std::nullopt;
+        case ParquetType::INT64:
+            if (auto v = load<int64_t>(bytes)) return Value::from_i64(*v);
+            return std::nullopt;
+        case ParquetType::FLOAT:
+            if (auto v = load<float>(bytes); v && !std::isnan(*v)) return Value::from_float(*v);
+            return std::nullopt;
+        case ParquetType::DOUBLE:
+            if (auto v = load<double>(bytes); v && !std::isnan(*v)) return Value::from_double(*v);
+            return std::nullopt;
+        case ParquetType::BYTE_ARRAY:
+        case ParquetType::FIXED_LEN_BYTE_ARRAY:
+            return Value::from_string(bytes);
+        default:
+            // INT96 has no defined sort order
+            return std::nullopt;
+    }
+}
+
+enum class ValueKind { INTEGER, FLOATING, BYTES };
+
+ValueKind kind_of(const Value& v) {
+    switch (v.data.index()) {
+        case 0: case 1: case 2: return ValueKind::INTEGER;
+        case 3: case 4: return ValueKind::FLOATING;
+        default: return ValueKind::BYTES;
+    }
+}
+
+int64_t as_int64(const Value& v) {
+    return std::visit([](auto&& x) -> int64_t {
+        using T = std::decay_t<decltype(x)>;
+        if constexpr (std::is_integral_v<T>) return static_cast<int64_t>(x);
+        else return 0;
+    }, v.data);
+}
+
+// Zero-extends INT32 values so UINT_32 columns order above INT32_MAX
+uint64_t as_uint64(const Value& v) {
+    if (auto* i = std::get_if<int32_t>(&v.data)) return static_cast<uint32_t>(*i);
+    return static_cast<uint64_t>(as_int64(v));
+}
+
+double as_double(const Value& v) {
+    return std::visit([](auto&& x) -> double {
+        using T = std::decay_t<decltype(x)>;
+        if constexpr (std::is_arithmetic_v<T>) return static_cast<double>(x);
+        else return 0;
+    }, v.data);
+}
+
+// Big-endian two's complement, as DECIMAL stores byte arrays
+int compare_signed_be(std::string_view a, std::string_view b) {
+    bool neg_a = !a.empty() && (static_cast<uint8_t>(a[0]) & 0x80);
+    bool neg_b = !b.empty() && (static_cast<uint8_t>(b[0]) & 0x80);
+    if (neg_a != neg_b) return neg_a ? -1 : 1;
+    size_t n = std::max(a.size(), b.size());
+    uint8_t pad = neg_a ? 0xFF : 0x00;
+    for (size_t i = 0; i < n; i++) {
+        size_t pa = n - a.size(), pb = n - b.size();
+        uint8_t x = i < pa ? pad : static_cast<uint8_t>(a[i - pa]);
+        uint8_t y = i < pb ? pad : static_cast<uint8_t>(b[i - pb]);
+        if (x != y) return x < y ? -1 : 1;
+    }
+    return 0;
+}
+
+template <typename T>
+int three_way(T a, T b) {
+    return a < b ? -1 : (b < a ? 1 : 0);
+}
+
+} // namespace
+
+// ── ColumnStatistics ─────────────────────────────────────────────────────────
+
+ColumnStatistics decode_statistics(const Statistics& raw, const ColumnInfo& col) {
+    ColumnStatistics stats;
+    stats.null_count = raw.null_count;
+    stats.distinct_count = raw.distinct_count;
+
+    const std::string* min = nullptr;
+    const std::string* max = nullptr;
+    if (raw.min_value && raw.max_value) {
+        min = &*raw.min_value;
+        max = &*raw.max_value;
+    } else if (raw.min && raw.max && has_signed_order(col)) {
+        min = &*raw.min;
+        max = &*raw.max;
+    }
+    if (min && max) {
+        stats.min = decode_bound(*min, col);
+        stats.max = decode_bound(*max, col);
+        if (!stats.min || !stats.max) {
+            stats.min.reset();
+            stats.max.reset();
+        }
+    }
+    return stats;
+}
+
+ColumnStatistics decode_page_statistics(const ColumnIndex& index, size_t page,
+                                        const ColumnInfo& col) {
+    ColumnStatistics stats;
+    if (page < index.null_counts.size()) stats.null_count = index.null_counts[page];
+    if (page < index.null_pages.size() && index.null_pages[page]) return stats;
+    if (page < index.min_values.size() && page < index.max_values.size()) {
+        stats.min = decode_bound(index.min_values[page], col);
+        stats.max = decode_bound(index.max_values[page], col);
+        if (!stats.min || !stats.max) {
+            stats.min.reset();
+            stats.max.reset();
+        }
+    }
+    return stats;
+}
+
+int compare_values(const Value& a, const Value& b, const ColumnInfo& col) {
+    ValueKind ka = kind_of(a), kb = kind_of(b);
+    if ((ka == ValueKind::BYTES) != (kb == ValueKind::BYTES)) {
+        throw std::runtime_error("Cannot compare a byte array with a number in column '" +
+                                 col.path + "'");
+    }
+    if (ka == ValueKind::BYTES) {
+        if (col.is_decimal()) return compare_signed_be(a.str(), b.str());
+        return three_way(a.str().compare(b.str()), 0);
+    }
+    if (ka == ValueKind::FLOATING || kb == ValueKind::FLOATING) {
+        return three_way(as_double(a), as_double(b));
+    }
+    if (is_unsigned(col)) return three_way(as_uint64(a), as_uint64(b));
+    return three_way(as_int64(a), as_int64(b));
+}
+
+// ── ColumnPredicate ──────────────────────────────────────────────────────────
+
+bool ColumnPredicate::is_equality(const ColumnInfo& col) const {
+    return kind == Kind::RANGE && lower && upper && lower_inclusive && upper_inclusive &&
+           compare_values(*lower, *upper, col) == 0;
+}
+
+bool ColumnPredicate::might_match(const ColumnStatistics& stats, const ColumnInfo& col,
+                                  int64_t num_values) const {
+    switch (kind) {
+        case Kind::IS_NULL:
+            return !stats.null_count || *stats.null_count > 0;
+        case Kind::IS_NOT_NULL:
+            return !stats.null_count || *stats.null_count < num_values;
+        case Kind::RANGE:
+            break;
+    }
+    if (num_values == 0) return false;
+    if (stats.null_count && *stats.null_count >= num_values) return false;
+    if (!stats.has_min_max()) return true;
+    if (lower) {
+        int c = compare_values(*stats.max, *lower, col);
+        if (c < 0 || (c == 0 && !lower_inclusive)) return false;
+    }
+    if (upper) {
+        int c = compare_values(*stats.min, *upper, col);
+        if (c > 0 || (c == 0 && !upper_inclusive)) return false;
+    }
+    return true;
+}
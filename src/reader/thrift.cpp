@@ -33,10 +33,16 @@ double ThriftReader::read_double() {
     return buf_.read<double>();
 }
 
-std::string ThriftReader::read_string() {
-    uint32_t len = static_cast<uint32_t>(buf_.read_varint());
-    const uint8_t* ptr = buf_.read_bytes(len);
-    return std::string(reinterpret_cast<const char*>(ptr), len);
+std::string ThriftReader::read_string() { return std::string(read_string_view()); }
+
+std::string_view ThriftReader::read_string_view() {
+    uint64_t len = buf_.read_varint();
+    if (len > buf_.remaining()) {
+        throw std::runtime_error("ThriftReader: string of " + std::to_string(len) +
+                                 " bytes exceeds the buffer");
+    }
+    const uint8_t* ptr = buf_.read_bytes(static_cast<size_t>(len));
+    return std::string_view(reinterpret_cast<const char*>(ptr), static_cast<size_t>(len));
 }
 
 std::string ThriftReader::read_binary() { return read_string(); }
@@ -55,17 +61,29 @@ ThriftReader::ListHeader ThriftReader::read_list_begin() {
 }
 
 void ThriftReader::read_struct_begin() {
-    field_id_stack_.push(last_field_id_);
+    if (depth_ == MAX_DEPTH) {
+        throw std::runtime_error("ThriftReader: structs nested deeper than " +
+                                 std::to_string(MAX_DEPTH));
+    }
+    field_id_stack_[depth_++] = last_field_id_;
     last_field_id_ = 0;
 }
 
 void ThriftReader::read_struct_end() {
-    last_field_id_ = field_id_stack_.top();
-    field_id_stack_.pop();
+    if (depth_ == 0) throw std::runtime_error("ThriftReader: unbalanced struct end");
+    last_field_id_ = field_id_stack_[--depth_];
 }
 
-void ThriftReader::skip(uint8_t type) {
+void ThriftReader::skip(uint8_t type) { skip(type, 0); }
+
+// `depth` counts enclosing containers, so nested lists are bounded like
+// nested structs
+void ThriftReader::skip(uint8_t type, size_t depth) {
     using namespace ThriftCompactType;
+    if (depth > MAX_DEPTH) {
+        throw std::runtime_error("ThriftReader: values nested deeper than " +
+                                 std::to_string(MAX_DEPTH));
+    }
     switch (type) {
         case CT_BOOLEAN_TRUE:
         case CT_BOOLEAN_FALSE:
@@ -82,12 +100,17 @@ void ThriftReader::skip(uint8_t type) {
             buf_.read_bytes(8);
             break;
         case CT_BINARY:
-            read_string();
+            read_string_view();
             break;
         case CT_LIST:
         case CT_SET: {
             auto lh = read_list_begin();
-            for (int32_t i = 0; i < lh.count; i++) skip(lh.elem_type);
+            // Booleans take a byte each inside a list, unlike in a field header
+            bool bools = lh.elem_type == CT_BOOLEAN_TRUE || lh.elem_type == CT_BOOLEAN_FALSE;
+            for (int32_t i = 0; i < lh.count; i++) {
+                if (bools) buf_.read_byte();
+                else skip(lh.elem_type, depth + 1);
+            }
             break;
         }
         case CT_MAP: {
@@ -97,8 +120,8 @@ void ThriftReader::skip(uint8_t type) {
                 uint8_t key_type = (kv_byte >> 4) & 0x0F;
                 uint8_t val_type = kv_byte & 0x0F;
                 for (int32_t i = 0; i < count; i++) {
-                    skip(key_type);
-                    skip(val_type);
+                    skip(key_type, depth + 1);
+                    skip(val_type, depth + 1);
                 }
             }
             break;
@@ -108,7 +131,7 @@ void ThriftReader::skip(uint8_t type) {
             while (true) {
                 auto fh = read_field_begin();
                 if (fh.type == CT_STOP) break;
-                skip(fh.type);
+                skip(fh.type, depth + 1);
             }
             read_struct_end();
             break;
@@ -44,7 +44,7 @@ size_t ParquetWriter::estimate_row_size(const Value& v, ParquetType type) {
         case ParquetType::INT64:
         case ParquetType::DOUBLE:   return 8;
         case ParquetType::BYTE_ARRAY: {
-            const std::string& s = std::get<std::string>(v.data);
+            std::string_view s = v.str();
             return 4 + s.size(); // 4-byte length prefix + data
         }
         default: return 0;
@@ -180,7 +180,7 @@ std::vector<uint8_t> ParquetWriter::plain_encode_values(const Value* values, siz
                 break;
             }
             case ParquetType::BYTE_ARRAY: {
-                const std::string& s = std::get<std::string>(v.data);
+                std::string_view s = v.str();
                 uint32_t len = static_cast<uint32_t>(s.size());
                 uint8_t len_buf[4];
                 std::memcpy(len_buf, &len, 4);
@@ -250,6 +250,16 @@ std::vector<uint8_t> ParquetWriter::encode_data_page(const Value* values, size_t
 
 // ── Dictionary Encoding ──────────────────────────────────────────────────────
 
+ParquetWriter::ValueData ParquetWriter::dict_key(const Value& v) {
+    return std::visit([](auto&& arg) -> ValueData {
+        using T = std::decay_t<decltype(arg)>;
+        if constexpr (std::is_same_v<T, std::string>)
+            return std::string_view(arg);
+        else
+            return arg;
+    }, v.data);
+}
+
 ParquetWriter::DictionaryResult
 ParquetWriter::analyze_column(const std::vector<Value>& values) {
     DictionaryResult result;
@@ -259,10 +269,11 @@ ParquetWriter::analyze_column(const std::vector<Value>& values) {
         if (v.is_null) continue;
         num_non_null++;
 
-        auto it = result.dict_map.find(v.data);
+        ValueData key = dict_key(v);
+        auto it = result.dict_map.find(key);
         if (it == result.dict_map.end()) {
             uint32_t idx = static_cast<uint32_t>(result.dict_values.size());
-            result.dict_map[v.data] = idx;
+            result.dict_map.emplace(std::move(key), idx);
             result.dict_values.push_back(v);
         }
     }
@@ -341,7 +352,7 @@ ParquetWriter::encode_dict_data_page(const Value* values, size_t count,
     RleBpEncoder encoder(bit_width);
     for (size_t i = 0; i < count; i++) {
         if (values[i].is_null) continue;
-        auto it = dict.dict_map.find(values[i].data);
+        auto it = dict.dict_map.find(dict_key(values[i]));
         encoder.WriteValue(it->second);
     }
     encoder.FinishWrite(page_payload);
@@ -0,0 +1,751 @@
+#!/usr/bin/env python3
+"""Write the Parquet fixtures the tests read.
+
+ParquetWriter cannot produce statistics, page indexes, CRCs or compressed
+pages, so the fixtures are written here, byte by byte, from a minimal
+Thrift compact encoder. Run from any directory; files are written next to
+this script. SNAPPY and LZ4_RAW pages come from the small block encoders
+below; the ZSTD fixture needs the `zstandard` module.
+"""
+import os
+import struct
+import zlib
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+# ── Thrift compact protocol ──────────────────────────────────────────────────
+
+BOOL, I32, I64, BIN, LIST, STRUCT = 1, 5, 6, 8, 9, 12
+
+
+def varint(v):
+    out = bytearray()
+    while v >= 0x80:
+        out.append((v & 0x7F) | 0x80)
+        v >>= 7
+    out.append(v)
+    return bytes(out)
+
+
+def zigzag(v):
+    return varint(((v << 1) ^ (v >> 63)) & ((1 << 64) - 1))
+
+
+class Struct:
+    """A Thrift struct: (field id, type, value) triples; None values are omitted."""
+
+    def __init__(self, *fields):
+        self.fields = [f for f in fields if f[2] is not None]
+
+    def add(self, *fields):
+        self.fields += [f for f in fields if f[2] is not None]
+
+    def encode(self):
+        out = bytearray()
+        last = 0
+        for fid, t, v in sorted(self.fields, key=lambda f: f[0]):
+            wire = (1 if v else 2) if t == BOOL else t
+            if 0 < fid - last <= 15:
+                out.append(((fid - last) << 4) | wire)
+            else:
+                out.append(wire)
+                out += zigzag(fid)
+            last = fid
+            if t != BOOL:
+                out += encode_value(t, v)
+        out.append(0)
+        return bytes(out)
+
+
+def encode_value(t, v):
+    if t in (I32, I64):
+        return zigzag(v)
+    if t == BIN:
+        v = v.encode() if isinstance(v, str) else v
+        return varint(len(v)) + v
+    if t == BOOL:
+        return bytes([1 if v else 2])
+    if t == STRUCT:
+        return v.encode()
+    if t == LIST:
+        elem, items = v
+        head = bytes([(len(items) << 4) | elem]) if len(items) < 15 else \
+            bytes([0xF0 | elem]) + varint(len(items))
+        return head + b"".join(encode_value(elem, i) for i in items)
+    raise ValueError(t)
+
+# ── Page encoding ────────────────────────────────────────────────────────────
+
+PHYSICAL = {"BOOLEAN": 0, "INT32": 1, "INT64": 2, "INT96": 3, "FLOAT": 4, "DOUBLE": 5,
+            "BYTE_ARRAY": 6, "FIXED_LEN_BYTE_ARRAY": 7}
+DECIMAL = 5  # ConvertedType
+CODECS = {"UNCOMPRESSED": 0, "SNAPPY": 1, "GZIP": 2, "ZSTD": 6, "LZ4_RAW": 7}
+PLAIN, RLE, RLE_DICTIONARY = 0, 3, 8
+
+
+DAY_NANOS = 86400 * 10**9
+JULIAN_EPOCH = 2440588  # Julian day of 1970-01-01
+
+
+def plain(ptype, values):
+    fmt = {"INT32": "<i", "INT64": "<q", "FLOAT": "<f", "DOUBLE": "<d"}
+    if ptype == "BYTE_ARRAY":
+        return b"".join(struct.pack("<I", len(v)) + v for v in map(to_bytes, values))
+    if ptype == "FIXED_LEN_BYTE_ARRAY":
+        return b"".join(values)
+    if ptype == "INT96":  # nanoseconds since the epoch as (nanos of day, Julian day)
+        return b"".join(struct.pack("<qi", v % DAY_NANOS, v // DAY_NANOS + JULIAN_EPOCH)
+                        for v in values)
+    return b"".join(struct.pack(fmt[ptype], v) for v in values)
+
+
+def to_bytes(v):
+    return v.encode() if isinstance(v, str) else v
+
+
+def rle_levels(levels):
+    """Repetition or definition levels (bit width up to 8) as RLE runs."""
+    out = bytearray()
+    i = 0
+    while i < len(levels):
+        j = i
+        while j < len(levels) and levels[j] == levels[i]:
+            j += 1
+        out += varint((j - i) << 1) + bytes([levels[i]])
+        i = j
+    return bytes(out)
+
+
+def bit_packed(values, bit_width):
+    """One bit-packed run, padded to a multiple of 8 values."""
+    n = (len(values) + 7) // 8 * 8
+    acc = 0
+    for i, v in enumerate(values):
+        acc |= v << (i * bit_width)
+    return varint(((n // 8) << 1) | 1) + acc.to_bytes(n * bit_width // 8, "little")
+
+
+def stat_bytes(ptype, v):
+    return to_bytes(v) if ptype == "BYTE_ARRAY" else plain(ptype, [v])
+
+
+def statistics(ptype, values, legacy=False):
+    present = [v for v in values if v is not None]
+    nulls = len(values) - len(present)
+    if not present:
+        return Struct((3, I64, nulls))
+    lo, hi = stat_bytes(ptype, min(present)), stat_bytes(ptype, max(present))
+    if legacy:  # deprecated signed min / max fields
+        return Struct((1, BIN, hi), (2, BIN, lo), (3, I64, nulls))
+    return Struct((3, I64, nulls), (5, BIN, hi), (6, BIN, lo))
+
+
+def compress(codec, data):
+    if codec == "UNCOMPRESSED":
+        return data
+    if codec == "SNAPPY":
+        return snappy_block(data)
+    if codec == "LZ4_RAW":
+        return lz4_block(data)
+    if codec == "GZIP":
+        # Two gzip members, which readers must decode back to back
+        half = len(data) // 2
+        out = b""
+        for part in (data[:half], data[half:]):
+            z = zlib.compressobj(6, zlib.DEFLATED, 31)
+            out += z.compress(part) + z.flush()
+        return out
+    if codec == "ZSTD":
+        import zstandard
+        return zstandard.ZstdCompressor(level=3).compress(data)
+    raise ValueError(codec)
+
+
+def matches(data, limit, end, max_offset):
+    """Greedy LZ77 over data[:limit]: (start, offset, length) of 4-byte or
+    longer matches, ending at or before `end`. Offsets may be smaller than
+    lengths, so runs become overlapping copies."""
+    table = {}
+    i = 0
+    while i < limit:
+        key = data[i:i + 4]
+        cand = table.get(key)
+        table[key] = i
+        if cand is None or i - cand > max_offset:
+            i += 1
+            continue
+        length = 4
+        while i + length < end and data[cand + length] == data[i + length]:
+            length += 1
+        yield i, i - cand, length
+        i += length
+
+
+def snappy_literal(lit):
+    n = len(lit) - 1
+    if n < 60:
+        return bytes([n << 2]) + lit
+    width = (n.bit_length() + 7) // 8
+    return bytes([(59 + width) << 2]) + n.to_bytes(width, "little") + lit
+
+
+def snappy_block(data):
+    """Raw Snappy block. Copies cycle through the 1-, 2- and 4-byte offset
+    tags (where the offset and length allow), so all three are written."""
+    out = bytearray(varint(len(data)))
+    anchor = 0
+    kind = 0
+    for start, offset, length in matches(data, len(data) - 3, len(data), 0xFFFF):
+        if start > anchor:
+            out += snappy_literal(data[anchor:start])
+        anchor = start + length
+        while length > 0:
+            n = min(length, 64)
+            if kind == 0 and 4 <= n <= 11 and offset < 2048:
+                out += bytes([1 | ((n - 4) << 2) | ((offset >> 8) << 5), offset & 0xFF])
+            elif kind == 2:
+                out += bytes([3 | ((n - 1) << 2)]) + offset.to_bytes(4, "little")
+            else:
+                out += bytes([2 | ((n - 1) << 2)]) + offset.to_bytes(2, "little")
+            kind = (kind + 1) % 3
+            length -= n
+    if anchor < len(data):
+        out += snappy_literal(data[anchor:])
+    return bytes(out)
+
+
+def lz4_length(n):
+    """Extension bytes of a token nibble that is 15."""
+    return b"\xff" * ((n - 15) // 255) + bytes([(n - 15) % 255]) if n >= 15 else b""
+
+
+def lz4_block(data):
+    """Raw LZ4 block. As the format requires, the last match starts at
+    least 12 bytes before the end and the last 5 bytes are literals."""
+    out = bytearray()
+    anchor = 0
+    for start, offset, length in matches(data, len(data) - 12, len(data) - 5, 0xFFFF):
+        lit = start - anchor
+        out.append((min(lit, 15) << 4) | min(length - 4, 15))
+        out += lz4_length(lit) + data[anchor:start] + offset.to_bytes(2, "little")
+        out += lz4_length(length - 4)
+        anchor = start + length
+    lit = len(data) - anchor
+    out.append(min(lit, 15) << 4)
+    out += lz4_length(lit) + data[anchor:]
+    return bytes(out)
+
+
+def crc(data):
+    c = zlib.crc32(data)
+    return c - (1 << 32) if c >= 1 << 31 else c
+
+# ── Bloom filters ────────────────────────────────────────────────────────────
+
+M64 = (1 << 64) - 1
+P1, P2, P3 = 0x9E3779B185EBCA87, 0xC2B2AE3D27D4EB4F, 0x165667B19E3779F9
+P4, P5 = 0x85EBCA77C2B2AE63, 0x27D4EB2F165667C5
+SALT = [0x47B6137B, 0x44974D91, 0x8824AD5B, 0xA2B7289D,
+        0x705495C7, 0x2DF1424B, 0x9EFC4947, 0x5C6BFB31]
+
+
+def rotl(x, r):
+    return ((x << r) | (x >> (64 - r))) & M64
+
+
+def xxh_round(acc, lane):
+    return rotl((acc + lane * P2) & M64, 31) * P1 & M64
+
+
+def xxh64(data, seed=0):
+    n, p = len(data), 0
+    if n >= 32:
+        v = [(seed + P1 + P2) & M64, (seed + P2) & M64, seed, (seed - P1) & M64]
+        while p + 32 <= n:
+            for k in range(4):
+                v[k] = xxh_round(v[k], struct.unpack_from("<Q", data, p + 8 * k)[0])
+            p += 32
+        h = (rotl(v[0], 1) + rotl(v[1], 7) + rotl(v[2], 12) + rotl(v[3], 18)) & M64
+        for k in range(4):
+            h = ((h ^ xxh_round(0, v[k])) * P1 + P4) & M64
+    else:
+        h = (seed + P5) & M64
+    h = (h + n) & M64
+    while p + 8 <= n:
+        h = (rotl(h ^ xxh_round(0, struct.unpack_from("<Q", data, p)[0]), 27) * P1 + P4) & M64
+        p += 8
+    if p + 4 <= n:
+        h = (rotl(h ^ (struct.unpack_from("<I", data, p)[0] * P1 & M64), 23) * P2 + P3) & M64
+        p += 4
+    while p < n:
+        h = rotl(h ^ (data[p] * P5 & M64), 11) * P1 & M64
+        p += 1
+    h = (h ^ (h >> 33)) * P2 & M64
+    h = (h ^ (h >> 29)) * P3 & M64
+    return h ^ (h >> 32)
+
+
+def bloom_filter(ptype, values, num_bytes):
+    """Header and bitset of a split-block filter holding `values`."""
+    words = [0] * (num_bytes // 4)
+    blocks = num_bytes // 32
+    for v in set(v for v in values if v is not None):
+        h = xxh64(stat_bytes(ptype, v))
+        block, key = ((h >> 32) * blocks) >> 32, h & 0xFFFFFFFF
+        for i in range(8):
+            words[block * 8 + i] |= 1 << (((key * SALT[i]) & 0xFFFFFFFF) >> 27)
+    empty = Struct((1, STRUCT, Struct()))  # BLOCK / XXHASH / UNCOMPRESSED
+    header = Struct((1, I32, num_bytes), (2, STRUCT, empty), (3, STRUCT, empty),
+                    (4, STRUCT, empty))
+    return header.encode() + struct.pack("<%dI" % len(words), *words)
+
+# ── File writer ──────────────────────────────────────────────────────────────
+
+
+class Column:
+    """A leaf column. With list_depth > 0 it is nested in that many optional
+    3-level LISTs of optional elements, each value is a row's (possibly None
+    or nested) list, and page_rows counts level entries, so lists can span
+    pages."""
+
+    def __init__(self, name, ptype, values, required=False, page_rows=1000,
+                 dictionary=False, list_depth=0, type_length=None, decimal=None):
+        self.name, self.ptype, self.values = name, ptype, values
+        self.required, self.page_rows, self.dictionary = required, page_rows, dictionary
+        self.list_depth = list_depth
+        self.type_length = type_length  # FIXED_LEN_BYTE_ARRAY; values are bytes
+        self.decimal = decimal          # (precision, scale)
+        self.max_rep = list_depth
+        # optional group, repeated list, then the optional element: the next
+        # level down or the leaf
+        self.max_def = 2 * list_depth + 1 if list_depth else (0 if required else 1)
+
+    def entries(self, values):
+        """(repetition level, definition level, value) per level entry."""
+        if not self.list_depth:
+            return [(0, 0 if v is None else self.max_def, v) for v in values]
+        out = []
+
+        def emit(v, level, rep, d):
+            if v is None:
+                out.append((rep, d, None))
+                return
+            if not v:
+                out.append((rep, d + 1, None))
+                return
+            for j, item in enumerate(v):
+                r = rep if j == 0 else level + 1
+                if level + 1 < self.list_depth:
+                    emit(item, level + 1, r, d + 2)
+                else:
+                    out.append((r, d + 2 + (item is not None), item))
+
+        for row in values:
+            # A Continuation row (malformed) carries on the previous row's list
+            emit(list(row), 0, 1, 0) if isinstance(row, Continuation) else emit(row, 0, 0, 0)
+        return out
+
+
+class Continuation(list):
+    pass
+
+
+class Chunk:
+    """What was written for one column chunk, for the page index."""
+
+    def __init__(self, column, values, meta, chunk):
+        self.column, self.values, self.meta, self.chunk = column, values, meta, chunk
+        self.pages = []  # (offset, size with header, first row, values)
+
+
+def write_chunk(out, col, values, codec, with_crc, stats, page_stats=False, page_v2=False):
+    start = len(out)
+    uncompressed = 0  # pages with their payloads decompressed, headers included
+    dict_offset = None
+    index = None
+    entries = col.entries(values)
+    leaves = [v for _, d, v in entries if d == col.max_def]
+    if col.dictionary:
+        distinct = list(dict.fromkeys(leaves))
+        index = {v: i for i, v in enumerate(distinct)}
+        body = plain(col.ptype, distinct)
+        stored = compress(codec, body)
+        header = Struct((1, I32, 2), (2, I32, len(body)), (3, I32, len(stored)),
+                        (4, I32, crc(stored) if with_crc else None),
+                        (7, STRUCT, Struct((1, I32, len(distinct)), (2, I32, PLAIN))))
+        dict_offset = len(out)
+        uncompressed += len(header.encode()) + len(body)
+        out += header.encode() + stored
+
+    data_offset = len(out)
+    chunk_pages = []
+    rows = 0
+    for first in range(0, len(entries), col.page_rows):
+        page = entries[first:first + col.page_rows]
+        present = [v for _, d, v in page if d == col.max_def]
+        reps = rle_levels([r for r, _, _ in page]) if col.max_rep else b""
+        defs = rle_levels([d for _, d, _ in page]) if col.max_def else b""
+        if index is not None:
+            width = max(1, (len(index) - 1).bit_length())
+            data = bytes([width]) + bit_packed([index[v] for v in present], width)
+            encoding = RLE_DICTIONARY
+        else:
+            data = plain(col.ptype, present)
+            encoding = PLAIN
+        page_stats_struct = statistics(col.ptype, [v for _, _, v in page]) if page_stats else None
+        if page_v2:
+            # Levels without length prefixes, stored uncompressed; every
+            # third page leaves its values uncompressed too
+            compressed = len(chunk_pages) % 3 != 2
+            body = reps + defs + data
+            stored = reps + defs + (compress(codec, data) if compressed else data)
+            header = Struct((1, I32, 3), (2, I32, len(body)), (3, I32, len(stored)),
+                            (4, I32, crc(stored) if with_crc else None),
+                            (8, STRUCT, Struct((1, I32, len(page)),
+                                               (2, I32, len(page) - len(present)),
+                                               (3, I32, sum(r == 0 for r, _, _ in page)),
+                                               (4, I32, encoding), (5, I32, len(defs)),
+                                               (6, I32, len(reps)), (7, BOOL, compressed),
+                                               (8, STRUCT, page_stats_struct))))
+        else:
+            body = b"".join(struct.pack("<I", len(lv)) + lv for lv in (reps, defs) if lv) + data
+            stored = compress(codec, body)
+            header = Struct((1, I32, 0), (2, I32, len(body)), (3, I32, len(stored)),
+                            (4, I32, crc(stored) if with_crc else None),
+                            (5, STRUCT, Struct((1, I32, len(page)), (2, I32, encoding),
+                                               (3, I32, RLE), (4, I32, RLE),
+                                               (5, STRUCT, page_stats_struct))))
+        encoded = header.encode()
+        chunk_pages.append((len(out), len(encoded) + len(stored), rows,
+                            [v if d == col.max_def else None for _, d, v in page]))
+        rows += sum(r == 0 for r, _, _ in page)
+        uncompressed += len(encoded) + len(body)
+        out += encoded + stored
+
+    meta = Struct((1, I32, PHYSICAL[col.ptype]), (2, LIST, (I32, [PLAIN, RLE])),
+                  (3, LIST, (BIN, [col.name])), (4, I32, CODECS[codec]),
+                  (5, I64, len(entries)), (6, I64, uncompressed),
+                  (7, I64, len(out) - start), (9, I64, data_offset),
+                  (11, I64, dict_offset),
+                  (12, STRUCT, statistics(col.ptype, [v for _, _, v in entries],
+                                          stats == "legacy")
+                   if stats else None))
+    chunk = Chunk(col, values, meta, Struct((2, I64, start), (3, STRUCT, meta)))
+    chunk.pages = chunk_pages
+    return chunk
+
+
+def column_index(chunk):
+    ptype = chunk.column.ptype
+    null_pages, mins, maxs, null_counts, bounds = [], [], [], [], []
+    for _, _, _, page in chunk.pages:
+        present = [v for v in page if v is not None]
+        null_pages.append(not present)
+        mins.append(stat_bytes(ptype, min(present)) if present else b"")
+        maxs.append(stat_bytes(ptype, max(present)) if present else b"")
+        null_counts.append(len(page) - len(present))
+        if present:
+            bounds.append((min(present), max(present)))
+    pairs = list(zip(bounds, bounds[1:]))
+    if all(a[0] <= b[0] and a[1] <= b[1] for a, b in pairs):
+        order = 1  # ASCENDING
+    elif all(a[0] >= b[0] and a[1] >= b[1] for a, b in pairs):
+        order = 2  # DESCENDING
+    else:
+        order = 0
+    return Struct((1, LIST, (BOOL, null_pages)), (2, LIST, (BIN, mins)),
+                  (3, LIST, (BIN, maxs)), (4, I32, order),
+                  (5, LIST, (I64, null_counts)))
+
+
+def offset_index(chunk):
+    return Struct((1, LIST, (STRUCT, [Struct((1, I64, off), (2, I32, size), (3, I64, first))
+                                      for off, size, first, _ in chunk.pages])))
+
+
+def write(name, columns, row_groups=1, codec="UNCOMPRESSED", with_crc=False,
+          stats=None, page_index=False, sorting=None, bloom=None, bloom_length=True,
+          page_stats=False, page_v2=False):
+    """Write `columns` (equal length) split evenly into `row_groups`.
+
+    stats: None, "new" (min_value / max_value) or "legacy" (min / max).
+    bloom: size in bytes of a Bloom filter written for every chunk; its
+    length is recorded unless bloom_length is False.
+    sorting: [(column index, descending, nulls_first)] for every row group.
+    page_stats: also write min_value / max_value statistics in every data
+    page header.
+    page_v2: write DATA_PAGE_V2 pages instead of DATA_PAGE.
+    Returns the chunks written, by row group.
+    """
+    out = bytearray(b"PAR1")
+    num_rows = len(columns[0].values)
+    per_group = (num_rows + row_groups - 1) // row_groups
+    groups = []
+    for rg in range(row_groups):
+        lo, hi = rg * per_group, min(num_rows, (rg + 1) * per_group)
+        chunks = [write_chunk(out, col, col.values[lo:hi], codec, with_crc, stats, page_stats,
+                              page_v2)
+                  for col in columns]
+        groups.append(chunks)
+
+    if bloom:
+        for c in (c for chunks in groups for c in chunks):
+            data = bloom_filter(c.column.ptype, c.values, bloom)
+            c.meta.add((14, I64, len(out)), (15, I32, len(data) if bloom_length else None))
+            out += data
+
+    if page_index:
+        every = [c for chunks in groups for c in chunks]
+        for c in every:
+            data = column_index(c).encode()
+            c.chunk.add((6, I64, len(out)), (7, I32, len(data)))
+            out += data
+        for c in every:
+            data = offset_index(c).encode()
+            c.chunk.add((4, I64, len(out)), (5, I32, len(data)))
+            out += data
+
+    schema = [Struct((4, BIN, "schema"), (5, I32, len(columns)))]
+    for col in columns:
+        field = col.name
+        for _ in range(col.list_depth):
+            # optional group <field> (LIST) { repeated group list { <element> } }
+            schema.append(Struct((3, I32, 1), (4, BIN, field), (5, I32, 1), (6, I32, 3)))
+            schema.append(Struct((3, I32, 2), (4, BIN, "list"), (5, I32, 1)))
+            field = "element"
+        precision, scale = col.decimal or (None, None)
+        schema.append(Struct((1, I32, PHYSICAL[col.ptype]), (2, I32, col.type_length),
+                             (3, I32, 0 if col.required else 1), (4, BIN, field),
+                             (6, I32, DECIMAL if col.decimal else None), (7, I32, scale),
+                             (8, I32, precision)))
+    rg_structs = []
+    for rg, chunks in enumerate(groups):
+        s = Struct((1, LIST, (STRUCT, [c.chunk for c in chunks])), (2, I64, 0),
+                   (3, I64, len(chunks[0].values)))
+        if sorting:
+            s.add((4, LIST, (STRUCT, [Struct((1, I32, i), (2, BOOL, d), (3, BOOL, n))
+                                      for i, d, n in sorting])))
+        rg_structs.append(s)
+    footer = Struct((1, I32, 1), (2, LIST, (STRUCT, schema)), (3, I64, num_rows),
+                    (4, LIST, (STRUCT, rg_structs))).encode()
+    out += footer + struct.pack("<I", len(footer)) + b"PAR1"
+    with open(os.path.join(HERE, name), "wb") as f:
+        f.write(out)
+    return groups
+
+# ── Fixtures ─────────────────────────────────────────────────────────────────
+
+
+def names(n):
+    """Dictionary-friendly strings with every tenth one null."""
+    return [None if i % 10 == 9 else "name%d" % (i % 13) for i in range(n)]
+
+
+def codec_columns():
+    ids = list(range(1000))
+    # Pseudo-random values give long literal runs; the constant column gives
+    # copies that overlap their own output
+    noise = [(i * 2654435761 + 97) % (1 << 40) for i in ids]
+    return [Column("id", "INT64", ids, required=True, page_rows=100),
+            Column("name", "BYTE_ARRAY", names(1000), page_rows=100, dictionary=True),
+            Column("noise", "INT64", noise, required=True, page_rows=100),
+            Column("fill", "INT32", [7] * 1000, required=True, page_rows=100)]
+
+
+def compression():
+    for codec in ("SNAPPY", "LZ4_RAW", "GZIP"):
+        write(codec.lower() + ".parquet", codec_columns(), row_groups=2, codec=codec,
+              with_crc=True)
+    # DATA_PAGE_V2 keeps its levels uncompressed; the same pages written
+    # without compression give the bytes read_page_data must return
+    xs = [None if i % 9 == 4 else i * 5 for i in range(300)]
+    for codec in ("SNAPPY", "UNCOMPRESSED"):
+        write("v2_" + codec.lower() + ".parquet",
+              [Column("x", "INT32", xs, page_rows=50),
+               Column("s", "BYTE_ARRAY", names(300), page_rows=50)],
+              codec=codec, with_crc=True, page_v2=True)
+    ids = list(range(1000))
+    try:
+        write("zstd.parquet", [Column("id", "INT64", ids, required=True, page_rows=100),
+                               Column("name", "BYTE_ARRAY", names(1000), page_rows=100,
+                                      dictionary=True)],
+              row_groups=2, codec="ZSTD", with_crc=True)
+    except ImportError:
+        print("zstandard is not installed; zstd.parquet left as is")
+
+
+def checksums():
+    groups = write("crc.parquet", [Column("x", "INT32", list(range(300)), required=True,
+                                          page_rows=50)], with_crc=True)
+    # Flip one payload byte of the third page
+    offset, size, _, _ = groups[0][0].pages[2]
+    with open(os.path.join(HERE, "crc.parquet"), "rb") as f:
+        data = bytearray(f.read())
+    data[offset + size - 1] ^= 0xFF
+    with open(os.path.join(HERE, "crc_corrupt.parquet"), "wb") as f:
+        f.write(data)
+
+
+def pruning():
+    # x: ascending, the last row group all null; s: the third row group's
+    # strings start with a multi-byte character, so they sort last unsigned
+    xs = [None if i >= 300 or i % 40 == 5 else i for i in range(400)]
+    ss = [("\u20ac%03d" if 200 <= i < 300 else "k%03d") % i for i in range(400)]
+    for name, kind in (("stats.parquet", "new"), ("stats_legacy.parquet", "legacy")):
+        write(name, [Column("x", "INT32", xs, page_rows=25),
+                     Column("s", "BYTE_ARRAY", ss, required=True, page_rows=25)],
+              row_groups=4, stats=kind)
+    write("page_index.parquet", [Column("s", "BYTE_ARRAY", ss, required=True, page_rows=50),
+                                 Column("x", "INT32", xs, page_rows=25)],
+          row_groups=4, stats="new", page_index=True)
+    write("page_stats.parquet", [Column("x", "INT32", xs, page_rows=25)],
+          row_groups=4, stats="new", page_stats=True)
+
+
+def bloom_filters():
+    # Even ids, shuffled so every row group's min / max span nearly all of
+    # them: odd ids are only ruled out by the filters
+    ids = [(i * 389) % 1000 * 2 for i in range(1000)]
+    users = ["user%d" % v for v in ids]
+    for name, length in (("bloom.parquet", True), ("bloom_no_length.parquet", False)):
+        write(name, [Column("id", "INT64", ids, required=True),
+                     Column("user", "BYTE_ARRAY", users, required=True)],
+              row_groups=4, stats="new", bloom=1024, bloom_length=length)
+
+
+def projection():
+    columns = [Column("c%d" % c, "INT32", [row * 10 + c for row in range(300)], page_rows=40)
+               for c in range(8)]
+    columns.append(Column("tag", "BYTE_ARRAY", names(300), page_rows=40, dictionary=True))
+    write("wide.parquet", columns, row_groups=3, stats="new", page_index=True)
+
+
+def sorted_keys():
+    # Runs of 30 equal keys cross the 20-row pages and 100-row row groups;
+    # the nulls fill the first row group and the first page of the second
+    keys = [None] * 120 + [(i // 30) * 3 for i in range(380)]
+    rows = list(range(500))
+    for name, descending, index in (("sorted.parquet", False, True),
+                                    ("sorted_no_index.parquet", False, False),
+                                    ("sorted_desc.parquet", True, True),
+                                    ("sorted_desc_no_index.parquet", True, False)):
+        # Descending files put the nulls last
+        k = keys[120:][::-1] + keys[:120] if descending else keys
+        write(name, [Column("k", "INT32", k, page_rows=20),
+                     Column("row", "INT64", rows, required=True, page_rows=20)],
+              row_groups=5, stats="new", page_index=index,
+              sorting=[(0, descending, not descending)])
+    # NaNs sort last: the fourth row group holds only NaN, so neither its
+    # chunk nor its page bounds are usable
+    nan = float("nan")
+    vs = [i / 2 if i < 300 else nan for i in range(400)]
+    for name, index in (("sorted_nan.parquet", True), ("sorted_nan_no_index.parquet", False)):
+        write(name, [Column("v", "DOUBLE", vs, required=True, page_rows=25)],
+              row_groups=4, stats="new", page_index=index, sorting=[(0, False, False)])
+
+
+def tag_row(i):
+    if i % 11 == 3:
+        return None
+    if i % 11 == 5:
+        return []
+    return [None if (i + j) % 7 == 0 else "t%d_%d" % (i, j) for j in range((i * 7) % 13)]
+
+
+def nested_row(i):
+    if i % 9 == 2:
+        return None
+    if i % 9 == 4:
+        return []
+    row = []
+    for j in range(i % 4 + 1):
+        if (i + j) % 5 == 3:
+            row.append(None)
+        elif (i + j) % 5 == 1:
+            row.append([])
+        else:
+            row.append([None if k == 1 and i % 2 == 0 else i * 10 + j * 3 + k
+                        for k in range((i + j) % 3 + 1)])
+    return row
+
+
+def lists():
+    # 16-entry pages, so lists of up to 12 elements often span two pages,
+    # including across the start of a row group's second page
+    write("lists.parquet", [Column("id", "INT32", list(range(120)), required=True),
+                            Column("tags", "BYTE_ARRAY", [tag_row(i) for i in range(120)],
+                                   page_rows=16, list_depth=1)],
+          row_groups=3)
+    # Malformed: the chunk opens with the rest of a list (repetition level 1)
+    rows = [Continuation(["c0", "c1"])] + [tag_row(i) for i in range(1, 10)]
+    write("list_continuation.parquet",
+          [Column("tags", "BYTE_ARRAY", rows, page_rows=4, list_depth=1)])
+    # A list of lists, with null and empty lists at both levels
+    write("nested_lists.parquet",
+          [Column("m", "INT32", [nested_row(i) for i in range(60)], page_rows=10, list_depth=2)],
+          row_groups=2)
+
+
+def timestamps():
+    stamps = [0, 1, DAY_NANOS - 1, 1700000000123456789, -1, -DAY_NANOS - 5]
+    values = [stamps[i % len(stamps)] for i in range(60)]
+    optional = [None if i % 4 == 1 else v for i, v in enumerate(values)]
+    write("int96.parquet", [Column("ts", "INT96", values, required=True, dictionary=True),
+                            Column("ts_plain", "INT96", values, required=True),
+                            Column("ts_opt", "INT96", optional, dictionary=True)],
+          row_groups=2)
+
+
+def dictionaries():
+    # Two versions of one file, for a dictionary cache keyed by file identity
+    groups = {}
+    for name, prefix in (("dictionary_a.parquet", "a"), ("dictionary_b.parquet", "bb")):
+        groups[name] = write(name, [Column("k", "BYTE_ARRAY",
+                                           [prefix + str(i % 5) for i in range(40)],
+                                           required=True, dictionary=True)], row_groups=2)
+    # The first page's indices are one 3-bit packed run of 20 (9 bytes); set
+    # the first two to 7, past the 5-entry dictionary
+    offset, size, _, _ = groups["dictionary_a.parquet"][0][0].pages[0]
+    with open(os.path.join(HERE, "dictionary_a.parquet"), "rb") as f:
+        data = bytearray(f.read())
+    data[offset + size - 9] = 0xFF
+    with open(os.path.join(HERE, "dictionary_corrupt.parquet"), "wb") as f:
+        f.write(data)
+
+
+def be(v, width):
+    """A FIXED_LEN_BYTE_ARRAY decimal: big-endian two's complement."""
+    return v.to_bytes(width, "big", signed=True)
+
+
+def decimals():
+    n = 200
+    d5 = [None if i % 7 == 3 else be((i - 100) * 5497558138 + i, 5) for i in range(n)]
+    big = [-(1 << 127), (1 << 127) - 1, 0, -1, 1, 10**37, -(10**37) + 7]
+    d16 = [be(big[i % len(big)] if i % 3 == 0 else (i - 100) * 10**30 + i, 16) for i in range(n)]
+    raw = [bytes([i, 7, 255 - i]) for i in range(n)]
+    write("decimals.parquet",
+          [Column("d9", "INT32", [i * 37 - 3000 for i in range(n)], required=True, page_rows=64,
+                  decimal=(9, 2)),
+           Column("d18", "INT64", [(i - 100) * 10**15 - i for i in range(n)], page_rows=64,
+                  decimal=(18, 4)),
+           Column("d5", "FIXED_LEN_BYTE_ARRAY", d5, page_rows=64, type_length=5,
+                  decimal=(10, 3)),
+           Column("d16", "FIXED_LEN_BYTE_ARRAY", d16, required=True, page_rows=64,
+                  dictionary=True, type_length=16, decimal=(38, 6)),
+           Column("raw", "FIXED_LEN_BYTE_ARRAY", raw, required=True, page_rows=64,
+                  type_length=3)],
+          row_groups=2)
+
+
+if __name__ == "__main__":
+    compression()
+    checksums()
+    pruning()
+    bloom_filters()
+    projection()
+    sorted_keys()
+    lists()
+    timestamps()
+    dictionaries()
+    decimals()
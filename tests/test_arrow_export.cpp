@@ -0,0 +1,187 @@
+#include "test_util.hpp"
+#include "reader/arrow_export.hpp"
+#include <cstring>
+
+// Arrow C Data Interface export, checked buffer by buffer against the
+// ColumnVector it was exported from. Columns come from decimals.parquet
+// (see test_decimals.cpp), int96.parquet (see test_int96.cpp),
+// snappy.parquet (see test_compression.cpp), page_index.parquet (see
+// test_page_index.cpp) and sorted_nan.parquet (see test_lower_bound.cpp);
+// BOOLEAN and FLOAT vectors are built here.
+
+namespace {
+
+bool arrow_valid(const ArrowArray& array, size_t i) {
+    if (!array.buffers[0]) return true;
+    auto bits = static_cast<const uint8_t*>(array.buffers[0]);
+    return bits[i / 8] & (1u << (i % 8));
+}
+
+// Export a copy of `vec` and compare every slot with the original
+void check_array(const ColumnVector& vec, const std::string& what) {
+    ColumnVector moved = vec;
+    ArrowArray array;
+    export_arrow_array(std::move(moved), &array);
+
+    // The vector is left empty but keeps its type
+    CHECK_EQ(moved.size, size_t{0});
+    CHECK(moved.data.empty() && moved.validity.empty() && moved.strings.data.empty());
+    CHECK(moved.type == vec.type);
+
+    CHECK_EQ(array.length, static_cast<int64_t>(vec.size));
+    CHECK_EQ(array.null_count, static_cast<int64_t>(vec.null_count));
+    CHECK_EQ(array.offset, int64_t{0});
+    CHECK_EQ(array.n_children, int64_t{0});
+    CHECK(array.release != nullptr);
+    CHECK_EQ(array.buffers[0] == nullptr, vec.null_count == 0);
+    CHECK(array.buffers[1] != nullptr);
+    bool strings = vec.type == VectorType::BYTE_ARRAY;
+    CHECK_EQ(array.n_buffers, int64_t{strings ? 3 : 2});
+
+    size_t bad = 0;
+    for (size_t i = 0; i < vec.size; i++) {
+        bool ok = arrow_valid(array, i) == !vec.is_null(i);
+        switch (vec.type) {
+            case VectorType::BOOLEAN: {
+                auto bits = static_cast<const uint8_t*>(array.buffers[1]);
+                ok = ok && ((bits[i / 8] >> (i % 8)) & 1) == (vec.data[i] != 0);
+                break;
+            }
+            case VectorType::DECIMAL64: {
+                // Widened to Arrow's 128-bit decimal
+                __int128 wide;
+                std::memcpy(&wide, static_cast<const uint8_t*>(array.buffers[1]) + 16 * i, 16);
+                ok = ok && wide == vec.values<int64_t>()[i];
+                break;
+            }
+            case VectorType::BYTE_ARRAY: {
+                auto offsets = static_cast<const int32_t*>(array.buffers[1]);
+                auto data = static_cast<const char*>(array.buffers[2]);
+                std::string s(data + offsets[i], static_cast<size_t>(offsets[i + 1] - offsets[i]));
+                ok = ok && s == vec.string(i);
+                break;
+            }
+            default:
+                ok = ok && std::memcmp(static_cast<const uint8_t*>(array.buffers[1]) +
+                                           i * vec.value_width,
+                                       vec.fixed(i), vec.value_width) == 0;
+                break;
+        }
+        bad += !ok;
+    }
+    if (bad) std::cerr << what << ": " << bad << " slot(s) differ\n";
+    CHECK_EQ(bad, size_t{0});
+
+    array.release(&array);
+    CHECK(array.release == nullptr);
+}
+
+void check_schema(const ColumnVector& vec, const ColumnInfo& info, const std::string& format,
+                  bool nullable) {
+    ArrowSchema schema;
+    export_arrow_schema(vec, info, &schema);
+    CHECK_EQ(std::string(schema.format), format);
+    CHECK_EQ(std::string(schema.name), info.path.empty() ? info.name : info.path);
+    CHECK_EQ(schema.flags, int64_t{nullable ? ARROW_FLAG_NULLABLE : 0});
+    CHECK_EQ(schema.n_children, int64_t{0});
+    CHECK(schema.metadata == nullptr);
+    schema.release(&schema);
+    CHECK(schema.release == nullptr);
+}
+
+const ColumnInfo& info(const ParquetReader& reader, const std::string& name) {
+    for (const auto& c : reader.columns()) {
+        if (c.name == name) return c;
+    }
+    throw std::runtime_error("no column " + name);
+}
+
+void check_column(const std::string& file, const std::string& name, const std::string& format,
+                  bool nullable) {
+    ParquetReader reader;
+    if (!open_fixture(reader, file)) return;
+    ColumnVector vec = reader.read_column_vector(name);
+    check_array(vec, file + " " + name);
+    check_schema(vec, info(reader, name), format, nullable);
+}
+
+void check_built_vectors() {
+    // BOOLEAN bytes are packed to bits; 13 slots leave a partial byte
+    ColumnVector flags;
+    flags.type = VectorType::BOOLEAN;
+    flags.value_width = 1;
+    flags.size = 13;
+    flags.validity = {0xFF, 0x1F};
+    for (size_t i = 0; i < flags.size; i++) flags.data.push_back(i % 3 == 0);
+    flags.validity[0] &= static_cast<uint8_t>(~(1u << 4));
+    flags.data[4] = 0;
+    flags.null_count = 1;
+    check_array(flags, "BOOLEAN");
+
+    ColumnVector floats;
+    floats.type = VectorType::FLOAT;
+    floats.value_width = 4;
+    floats.size = 3;
+    float values[] = {1.5f, -0.0f, 3e38f};
+    floats.data.resize(sizeof(values));
+    std::memcpy(floats.data.data(), values, sizeof(values));
+    check_array(floats, "FLOAT");
+
+    // An empty vector still exports non-null buffers
+    ColumnVector empty;
+    empty.type = VectorType::BYTE_ARRAY;
+    check_array(empty, "empty BYTE_ARRAY");
+}
+
+void check_batch() {
+    ParquetReader reader;
+    if (!open_fixture(reader, "decimals.parquet")) return;
+    RecordBatchReader batches(reader, {"d5", "raw"}, 50);
+    RecordBatch batch;
+    CHECK(batches.next(batch));
+    RecordBatch copy = batch;
+
+    ArrowSchema schema;
+    export_arrow_schema(batch, &schema);
+    CHECK_EQ(std::string(schema.format), "+s");
+    CHECK_EQ(schema.n_children, int64_t{2});
+    if (schema.n_children == 2) {
+        CHECK_EQ(std::string(schema.children[0]->format), "d:10,3");
+        CHECK_EQ(std::string(schema.children[0]->name), "d5");
+        CHECK_EQ(std::string(schema.children[1]->format), "w:3");
+    }
+    schema.release(&schema);
+
+    ArrowArray array;
+    export_arrow_array(std::move(batch), &array);
+    CHECK_EQ(batch.num_rows, size_t{0});
+    CHECK_EQ(array.length, int64_t{50});
+    CHECK_EQ(array.n_buffers, int64_t{1});
+    CHECK_EQ(array.n_children, int64_t{2});
+    if (array.n_children == 2) {
+        CHECK_EQ(array.children[0]->length, int64_t{50});
+        CHECK_EQ(array.children[0]->null_count, static_cast<int64_t>(copy.columns[0].null_count));
+        CHECK(std::memcmp(array.children[1]->buffers[1], copy.columns[1].data.data(), 150) == 0);
+    }
+    // Releasing the parent releases the children
+    array.release(&array);
+    CHECK(array.release == nullptr);
+}
+
+} // namespace
+
+int main() {
+    check_column("decimals.parquet", "d9", "d:9,2", false);
+    check_column("decimals.parquet", "d5", "d:10,3", true);
+    check_column("decimals.parquet", "d16", "d:38,6", false);
+    check_column("decimals.parquet", "raw", "w:3", false);
+    check_column("int96.parquet", "ts_opt", "tsn:", true);
+    check_column("snappy.parquet", "id", "l", false);
+    check_column("snappy.parquet", "name", "z", true);
+    check_column("snappy.parquet", "fill", "i", false);
+    check_column("page_index.parquet", "x", "i", true);
+    check_column("sorted_nan.parquet", "v", "g", false);
+    check_built_vectors();
+    check_batch();
+    return test_result();
+}
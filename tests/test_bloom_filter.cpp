@@ -0,0 +1,96 @@
+#include "reader/bloom_filter.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+
+// bloom.parquet: 1000 rows in 4 row groups, a 1 KB Bloom filter per chunk.
+//   id    INT64 = (row * 389) % 1000 * 2: every even id 0..1998 once,
+//         shuffled so each row group's min / max span nearly all of them
+//   user  BYTE_ARRAY "user<id>"
+// bloom_no_length.parquet: the same without bloom_filter_length, so the
+// reader has to find the bitset's size from its header.
+
+namespace {
+
+using P = ColumnPredicate;
+
+int64_t id_at(int64_t row) { return (row * 389) % 1000 * 2; }
+
+void check_filters(ParquetReader& reader) {
+    const ColumnInfo& id = reader.column("id");
+    const ColumnInfo& user = reader.column("user");
+    int false_positives = 0;
+    for (size_t rg = 0; rg < 4; rg++) {
+        auto ids = reader.bloom_filter("id", rg);
+        auto users = reader.bloom_filter("user", rg);
+        CHECK(ids && users);
+        if (!ids || !users) return;
+        CHECK_EQ(ids->num_bytes(), size_t{1024});
+
+        // No false negatives
+        const int64_t first = static_cast<int64_t>(rg) * 250;
+        for (int64_t row = first; row < first + 250; row++) {
+            int64_t v = id_at(row);
+            CHECK(ids->might_contain(Value::from_i64(v), id));
+            CHECK(users->might_contain(Value::from_string("user" + std::to_string(v)), user));
+        }
+        // Odd ids were never inserted
+        for (int64_t v = 1; v < 2000; v += 2) {
+            if (ids->might_contain(Value::from_i64(v), id)) false_positives++;
+        }
+    }
+    // 250 values in 32 blocks: a few percent at most
+    CHECK(false_positives < 4 * 1000 / 20);
+
+    // Every row group's bounds cover the odd ids; the filters rule them out
+    int kept = 0;
+    for (int64_t v = 1; v < 2000; v += 2) {
+        kept += static_cast<int>(reader.prune_row_groups("id", P::equal(Value::from_i64(v))).size());
+    }
+    CHECK(kept < 4 * 1000 / 20);
+    for (int64_t row = 0; row < 1000; row += 7) {
+        size_t rg = static_cast<size_t>(row / 250);
+        auto keep = reader.prune_row_groups("id", P::equal(Value::from_i64(id_at(row))));
+        CHECK(std::find(keep.begin(), keep.end(), rg) != keep.end());
+        keep = reader.prune_row_groups(
+            "user", P::equal(Value::from_string("user" + std::to_string(id_at(row)))));
+        CHECK(std::find(keep.begin(), keep.end(), rg) != keep.end());
+    }
+
+    // between(v, v) is probed like equal(v); wider ranges are not
+    CHECK_EQ(reader.prune_row_groups("id", P::between(Value::from_i64(1), Value::from_i64(1)))
+                 .size(), reader.prune_row_groups("id", P::equal(Value::from_i64(1))).size());
+    CHECK_EQ(reader.prune_row_groups("id", P::between(Value::from_i64(1001), Value::from_i64(1003)))
+                 .size(), size_t{4});
+}
+
+} // namespace
+
+int main() {
+    ParquetReader reader;
+    if (!open_fixture(reader, "bloom.parquet")) return test_result();
+
+    // XXH64 reference values
+    const ColumnInfo& user = reader.column("user");
+    CHECK(BloomFilter::hash(Value::from_string(""), user) == 0xEF46DB3751D8E999ull);
+    CHECK(BloomFilter::hash(Value::from_string("abc"), user) == 0x44BC2CF5AD770999ull);
+
+    // Literals are hashed as the column's type; inexact ones can't be answered
+    const ColumnInfo& id = reader.column("id");
+    CHECK(BloomFilter::hash(Value::from_i32(42), id) == BloomFilter::hash(Value::from_i64(42), id));
+    CHECK(!BloomFilter::hash(Value::from_double(2.5), id));
+    auto filter = reader.bloom_filter("id", 0);
+    CHECK(filter && filter->might_contain(Value::from_double(2.5), id));
+
+    check_filters(reader);
+
+    ParquetReader no_length;
+    if (!open_fixture(no_length, "bloom_no_length.parquet")) return test_result();
+    check_filters(no_length);
+
+    // Files without filters
+    ParquetReader plain;
+    if (!open_fixture(plain, "stats.parquet")) return test_result();
+    CHECK(!plain.bloom_filter("x", 0));
+
+    return test_result();
+}
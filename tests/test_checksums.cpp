@@ -0,0 +1,72 @@
+#include "reader/crc32.hpp"
+#include "test_util.hpp"
+#include <cstring>
+#include <vector>
+
+// crc.parquet: INT32 x = 0..299 in six 50-row pages, each with a CRC.
+// crc_corrupt.parquet: the same file with the last payload byte of the
+// third page (row 149) flipped.
+
+namespace {
+
+void check_crc32() {
+    const char* check = "123456789";
+    auto* bytes = reinterpret_cast<const uint8_t*>(check);
+    CHECK_EQ(crc32(bytes, 9), 0xCBF43926u);
+    CHECK_EQ(crc32_slicing8(bytes, 9), 0xCBF43926u);
+    CHECK_EQ(crc32(bytes + 4, 5, crc32(bytes, 4)), 0xCBF43926u);
+
+    // Long enough for the folding path, with an unaligned start and tail
+    std::vector<uint8_t> data(4099);
+    for (size_t i = 0; i < data.size(); i++) data[i] = static_cast<uint8_t>(i * 31 + 7);
+    for (size_t start : {0, 1, 3}) {
+        CHECK_EQ(crc32(data.data() + start, data.size() - start),
+                 crc32_slicing8(data.data() + start, data.size() - start));
+    }
+}
+
+} // namespace
+
+int main() {
+    check_crc32();
+
+    ParquetReader reader;
+    reader.set_verify_checksums(true);
+    if (!open_fixture(reader, "crc.parquet")) return test_result();
+    auto values = reader.read_column("x");
+    CHECK_EQ(values.size(), size_t{300});
+    for (size_t i = 0; i < values.size(); i++) {
+        CHECK_EQ(values[i].to_string(), std::to_string(i));
+    }
+    CHECK_EQ(reader.checksum_stats().verified.load(), uint64_t{6});
+    ColumnVector typed = reader.read_column_vector("x");
+    CHECK_EQ(typed.size, size_t{300});
+    CHECK_EQ(reader.checksum_stats().verified.load(), uint64_t{12});
+    CHECK_EQ(reader.checksum_stats().failed.load(), uint64_t{0});
+    CHECK_EQ(reader.checksum_stats().unchecked.load(), uint64_t{0});
+
+    // Every read path rejects the damaged page
+    ParquetReader corrupt;
+    corrupt.set_verify_checksums(true);
+    if (!open_fixture(corrupt, "crc_corrupt.parquet")) return test_result();
+    CHECK_THROWS(corrupt.read_column("x"));
+    CHECK_THROWS(corrupt.read_column_vector("x"));
+    CHECK_THROWS(corrupt.read_page_data(2));
+    CHECK(!corrupt.read_page_data(1).empty());
+    CHECK(corrupt.checksum_stats().failed >= 3);
+
+    // Verification is opt-in: without it the damaged value is read as is
+    ParquetReader unverified;
+    if (!open_fixture(unverified, "crc_corrupt.parquet")) return test_result();
+    values = unverified.read_column("x");
+    CHECK_EQ(values.size(), size_t{300});
+    CHECK(values[149].to_string() != "149");
+    CHECK_EQ(values[150].to_string(), "150");
+    CHECK_EQ(unverified.checksum_stats().verified.load(), uint64_t{0});
+
+    // open() resets the counters
+    corrupt.open(fixture("crc.parquet"));
+    CHECK_EQ(corrupt.checksum_stats().failed.load(), uint64_t{0});
+
+    return test_result();
+}
@@ -0,0 +1,141 @@
+#include "test_util.hpp"
+#include <algorithm>
+#include <cstdint>
+
+// ChunkTable, filled from the undecoded footer, against the ColumnMetaData
+// decoded for each chunk. wide.parquet (see test_projection.cpp) has 9
+// columns in 3 row groups, the last one dictionary encoded; snappy.parquet
+// (see test_compression.cpp) is SNAPPY compressed with a dictionary encoded
+// name column; lists.parquet (see test_lists.cpp) has a repeated column,
+// whose num_values counts level entries rather than rows. The fixtures of
+// compressed files record the decompressed chunk sizes apart from the
+// stored ones, so the two totals cannot be swapped unnoticed.
+
+namespace {
+
+// One chunk of `table` against `meta`
+bool same_chunk(const ChunkTable& table, size_t i, const ColumnMetaData& meta) {
+    return table.data_page_offset[i] == meta.data_page_offset &&
+           table.dictionary_page_offset[i] == meta.dictionary_page_offset.value_or(-1) &&
+           table.total_compressed_size[i] == meta.total_compressed_size &&
+           table.total_uncompressed_size[i] == meta.total_uncompressed_size &&
+           table.num_values[i] == meta.num_values && table.codec[i] == meta.codec;
+}
+
+bool empty_chunk(const ChunkTable& table, size_t i) {
+    return table.data_page_offset[i] == 0 && table.dictionary_page_offset[i] == -1 &&
+           table.total_compressed_size[i] == 0 && table.total_uncompressed_size[i] == 0 &&
+           table.num_values[i] == 0 && table.codec[i] == CompressionCodec::UNCOMPRESSED;
+}
+
+// First page of each chunk in the page index, by ChunkTable index
+std::vector<size_t> first_page_offsets(const ParquetReader& reader, const ChunkTable& table) {
+    std::vector<size_t> first(table.num_row_groups * table.num_columns, SIZE_MAX);
+    for (size_t id = 0; id < reader.num_pages(); id++) {
+        const auto& entry = reader.page_index_entry(id);
+        size_t i = table.index(entry.row_group_idx, entry.column_idx);
+        first[i] = std::min(first[i], entry.page_offset);
+    }
+    return first;
+}
+
+// Returns the number of projected chunks with a dictionary page
+size_t check_file(const std::string& file, const std::vector<std::string>& projection) {
+    ParquetReader reader, full;
+    reader.set_projection(projection);
+    if (!open_fixture(reader, file) || !open_fixture(full, file)) return 0;
+    const ChunkTable& table = reader.chunk_table();
+    CHECK_EQ(table.num_row_groups, reader.num_row_groups());
+    CHECK_EQ(table.num_columns, full.num_columns());
+    size_t n = table.num_row_groups * table.num_columns;
+    for (const auto* field : {&table.data_page_offset, &table.dictionary_page_offset,
+                              &table.total_compressed_size, &table.total_uncompressed_size,
+                              &table.num_values}) {
+        CHECK_EQ(field->size(), n);
+    }
+    CHECK_EQ(table.codec.size(), n);
+    if (table.codec.size() != n) return 0;
+
+    std::vector<bool> projected(table.num_columns, projection.empty());
+    for (const auto& name : projection) {
+        projected[static_cast<size_t>(full.column(name).column_index)] = true;
+    }
+    auto first = first_page_offsets(reader, table);
+    size_t dictionaries = 0;
+    for (size_t col = 0; col < table.num_columns; col++) {
+        for (size_t rg = 0; rg < table.num_row_groups; rg++) {
+            // Column-major: a column's chunks are adjacent
+            size_t i = table.index(rg, col);
+            CHECK_EQ(i, col * table.num_row_groups + rg);
+            const ColumnMetaData* meta = full.column_chunk_meta(rg, col);
+            CHECK(meta != nullptr);
+            if (!meta) continue;
+            if (!projected[col]) {
+                CHECK(empty_chunk(table, i));
+                continue;
+            }
+            if (!same_chunk(table, i, *meta)) {
+                std::cerr << file << ": row group " << rg << ", column " << col
+                          << " differs from its ColumnMetaData\n";
+                test_failures++;
+            }
+            // The chunk starts at its dictionary page, if any, and the
+            // page index's first data page follows
+            bool dictionary = meta->dictionary_page_offset.has_value();
+            dictionaries += dictionary;
+            int64_t start = dictionary ? *meta->dictionary_page_offset : meta->data_page_offset;
+            CHECK_EQ(table.start_offset(i), start);
+            CHECK_EQ(first[i], static_cast<size_t>(meta->data_page_offset));
+        }
+    }
+    return dictionaries;
+}
+
+void check_assign() {
+    ColumnMetaData meta;
+    meta.codec = CompressionCodec::ZSTD;
+    meta.num_values = 42;
+    meta.total_uncompressed_size = 900;
+    meta.total_compressed_size = 300;
+    meta.data_page_offset = 1000;
+    meta.dictionary_page_offset = 4;
+    ColumnChunk chunk;
+    chunk.meta_data = std::make_shared<const ColumnMetaData>(meta);
+
+    // Decoded metadata is copied without a footer
+    ChunkTable table;
+    table.resize(2, 3);
+    table.assign(1, 2, chunk, nullptr);
+    CHECK(same_chunk(table, table.index(1, 2), meta));
+    CHECK_EQ(table.start_offset(table.index(1, 2)), int64_t{4});
+    for (size_t i = 0; i < 6; i++) {
+        if (i != table.index(1, 2)) CHECK(empty_chunk(table, i));
+    }
+
+    // A dictionary offset past the data pages is not taken as the start
+    meta.dictionary_page_offset = 2000;
+    chunk.meta_data = std::make_shared<const ColumnMetaData>(meta);
+    table.assign(0, 0, chunk, nullptr);
+    CHECK_EQ(table.start_offset(table.index(0, 0)), int64_t{1000});
+
+    // A chunk with no metadata at all leaves its slot empty
+    table.assign(1, 0, ColumnChunk{}, nullptr);
+    CHECK(empty_chunk(table, table.index(1, 0)));
+
+    // resize() clears what was assigned
+    table.resize(2, 3);
+    for (size_t i = 0; i < 6; i++) CHECK(empty_chunk(table, i));
+}
+
+} // namespace
+
+int main() {
+    check_assign();
+    // tag and name have a dictionary page in every row group
+    CHECK_EQ(check_file("wide.parquet", {}), size_t{3});
+    CHECK_EQ(check_file("wide.parquet", {"c3", "tag"}), size_t{3});
+    CHECK_EQ(check_file("snappy.parquet", {}), size_t{2});
+    CHECK_EQ(check_file("snappy.parquet", {"name"}), size_t{2});
+    check_file("lists.parquet", {});
+    return test_result();
+}
@@ -0,0 +1,134 @@
+#include "reader/compression.hpp"
+#include "test_util.hpp"
+
+// snappy.parquet, lz4_raw.parquet, gzip.parquet and zstd.parquet: 1000
+// rows in 2 row groups of 100-row pages, with CRCs.
+//   id     INT64 0..999
+//   name   dictionary encoded, "name<i % 13>", every tenth row null
+//   noise  INT64 pseudo-random (snappy/lz4/gzip only): long literal runs
+//   fill   INT32 constant 7 (snappy/lz4/gzip only): self-overlapping copies
+// The SNAPPY pages use all three copy tags and extended literal lengths,
+// the LZ4_RAW pages literal and match lengths past 15, and the GZIP pages
+// hold two gzip members each.
+//
+// v2_snappy.parquet and v2_uncompressed.parquet: the same 300 rows in
+// DATA_PAGE_V2 pages of 50 rows; every third page of a chunk leaves its
+// values uncompressed.
+//   x  INT32 i * 5, null where i % 9 == 4
+//   s  BYTE_ARRAY "name<i % 13>", every tenth row null
+
+namespace {
+
+std::string expected_name(int64_t i) {
+    return i % 10 == 9 ? "NULL" : "name" + std::to_string(i % 13);
+}
+
+int64_t expected_noise(int64_t i) {
+    uint64_t v = static_cast<uint64_t>(i) * 2654435761u + 97;
+    return static_cast<int64_t>(v % (uint64_t{1} << 40));
+}
+
+void check_values(ParquetReader& reader, bool extra_columns) {
+    auto ids = reader.read_column("id");
+    CHECK_EQ(ids.size(), size_t{1000});
+    for (size_t i = 0; i < ids.size(); i++) {
+        CHECK_EQ(ids[i].to_string(), std::to_string(i));
+    }
+    auto names = reader.read_column("name");
+    CHECK_EQ(names.size(), size_t{1000});
+    for (size_t i = 0; i < names.size(); i++) {
+        CHECK_EQ(names[i].to_string(), expected_name(static_cast<int64_t>(i)));
+    }
+    if (!extra_columns) return;
+    auto noise = reader.read_column("noise");
+    CHECK_EQ(noise.size(), size_t{1000});
+    for (size_t i = 0; i < noise.size(); i++) {
+        CHECK_EQ(noise[i].to_string(), std::to_string(expected_noise(static_cast<int64_t>(i))));
+    }
+    auto fill = reader.read_column("fill");
+    CHECK_EQ(fill.size(), size_t{1000});
+    for (const auto& v : fill) CHECK_EQ(v.to_string(), "7");
+}
+
+void check_codec(const std::string& name, CompressionCodec codec, bool extra_columns) {
+    if (!codec_supported(codec)) {
+        std::cerr << "built without " << compression_name(codec) << " support; " << name
+                  << " skipped\n";
+        return;
+    }
+    ParquetReader reader;
+    if (!open_fixture(reader, name)) return;
+    CHECK(reader.page_index_entry(0).codec == codec);
+    check_values(reader, extra_columns);
+
+    // Typed decoding
+    ColumnVector ids = reader.read_column_vector("id");
+    CHECK_EQ(ids.size, size_t{1000});
+    for (size_t i = 0; i < ids.size; i++) {
+        CHECK_EQ(ids.values<int64_t>()[i], static_cast<int64_t>(i));
+    }
+
+    // Streaming strings skip the null rows
+    auto it = reader.column_iterator("name");
+    size_t seen = 0;
+    while (it.has_next()) {
+        auto [pos, len, ptr] = it.next();
+        CHECK_EQ(std::string(ptr, len), expected_name(static_cast<int64_t>(pos)));
+        seen++;
+    }
+    CHECK_EQ(seen, size_t{900});
+
+    // The CRCs cover the compressed payloads
+    ParquetReader verified;
+    verified.set_verify_checksums(true);
+    if (!open_fixture(verified, name)) return;
+    check_values(verified, extra_columns);
+    CHECK(verified.checksum_stats().verified > 0);
+    CHECK_EQ(verified.checksum_stats().failed.load(), uint64_t{0});
+}
+
+void check_data_page_v2() {
+    ParquetReader compressed, plain;
+    if (!open_fixture(compressed, "v2_snappy.parquet")) return;
+    if (!open_fixture(plain, "v2_uncompressed.parquet")) return;
+    CHECK_EQ(compressed.num_pages(), size_t{12});
+    CHECK_EQ(plain.num_pages(), size_t{12});
+
+    // Only the values are decompressed: the result is the page as stored
+    // without compression, levels first
+    for (size_t id = 0; id < compressed.num_pages() && id < plain.num_pages(); id++) {
+        const PageIndexEntry& entry = compressed.page_index_entry(id);
+        CHECK(entry.levels_size > 0);
+        CHECK_EQ(entry.levels_size, plain.page_index_entry(id).levels_size);
+        CHECK_EQ(entry.values_compressed, id % 6 % 3 != 2);
+        auto data = compressed.read_page_data(id);
+        auto expected = plain.read_page_data(id);
+        CHECK_EQ(data.size(), entry.payload_size());
+        CHECK_EQ(data.size(), expected.size());
+        CHECK(data == expected);
+    }
+
+    // The value readers do not decode V2 pages, and say so
+    CHECK_THROWS(compressed.read_column("x"));
+    CHECK_THROWS(plain.read_column_vector("x"));
+    for (ParquetReader* reader : {&compressed, &plain}) {
+        std::string error;
+        try {
+            reader->column_iterator("s");
+        } catch (const std::exception& e) {
+            error = e.what();
+        }
+        CHECK(error.find("DATA_PAGE_V2") != std::string::npos);
+    }
+}
+
+} // namespace
+
+int main() {
+    check_codec("snappy.parquet", CompressionCodec::SNAPPY, true);
+    check_codec("lz4_raw.parquet", CompressionCodec::LZ4_RAW, true);
+    check_codec("gzip.parquet", CompressionCodec::GZIP, true);
+    check_codec("zstd.parquet", CompressionCodec::ZSTD, false);
+    check_data_page_v2();
+    return test_result();
+}
@@ -0,0 +1,167 @@
+#include "test_util.hpp"
+#include "reader/decimal.hpp"
+#include <cstring>
+
+// decimals.parquet: 200 rows in 2 row groups of 64-row pages.
+//   d9   INT32 DECIMAL(9, 2)   i * 37 - 3000
+//   d18  INT64 DECIMAL(18, 4)  (i - 100) * 10^15 - i, optional, never null
+//   d5   FIXED_LEN_BYTE_ARRAY(5) DECIMAL(10, 3)  (i - 100) * 5497558138 + i,
+//        null where i % 7 == 3
+//   d16  FIXED_LEN_BYTE_ARRAY(16) DECIMAL(38, 6), dictionary encoded: every
+//        third row one of the extremes below, otherwise (i - 100) * 10^30 + i
+//   raw  FIXED_LEN_BYTE_ARRAY(3), no annotation: bytes {i, 7, 255 - i}
+
+namespace {
+
+using i128 = __int128;
+
+i128 pow10(int n) {
+    i128 v = 1;
+    while (n-- > 0) v *= 10;
+    return v;
+}
+
+const i128 INT128_MAX_ = static_cast<i128>(~static_cast<unsigned __int128>(0) >> 1);
+const i128 INT128_MIN_ = -INT128_MAX_ - 1;
+
+i128 expected_d16(int i) {
+    const i128 extremes[] = {INT128_MIN_, INT128_MAX_, 0, -1, 1, pow10(37), -pow10(37) + 7};
+    if (i % 3 == 0) return extremes[i % 7];
+    return (i - 100) * pow10(30) + i;
+}
+
+std::string str(i128 v) { return decimal_to_string(v, 0); }
+
+void check_vectors(ParquetReader& reader) {
+    ColumnVector d9 = reader.read_column_vector("d9");
+    CHECK(d9.type == VectorType::DECIMAL64);
+    CHECK_EQ(d9.size, size_t{200});
+    CHECK_EQ(d9.scale, 2);
+    CHECK_EQ(d9.precision, 9);
+    for (int i = 0; i < 200 && static_cast<size_t>(i) < d9.size; i++) {
+        CHECK_EQ(d9.values<int64_t>()[i], int64_t{i * 37 - 3000});
+    }
+
+    ColumnVector d18 = reader.read_column_vector("d18");
+    CHECK(d18.type == VectorType::DECIMAL64);
+    CHECK_EQ(d18.size, size_t{200});
+    CHECK_EQ(d18.null_count, size_t{0});
+    for (int i = 0; i < 200 && static_cast<size_t>(i) < d18.size; i++) {
+        CHECK_EQ(d18.values<int64_t>()[i], int64_t{i - 100} * 1000000000000000 - i);
+    }
+
+    // Five-byte FLBA decimals sign-extend into int64; null slots are zeroed
+    ColumnVector d5 = reader.read_column_vector("d5");
+    CHECK(d5.type == VectorType::DECIMAL64);
+    CHECK_EQ(d5.size, size_t{200});
+    CHECK_EQ(d5.scale, 3);
+    size_t nulls = 0;
+    for (int i = 0; i < 200 && static_cast<size_t>(i) < d5.size; i++) {
+        bool null = i % 7 == 3;
+        nulls += null;
+        CHECK_EQ(d5.is_null(static_cast<size_t>(i)), null);
+        CHECK_EQ(d5.values<int64_t>()[i], null ? 0 : int64_t{i - 100} * 5497558138 + i);
+    }
+    CHECK_EQ(d5.null_count, nulls);
+
+    // Sixteen-byte decimals through the dictionary, extremes included
+    ColumnVector d16 = reader.read_column_vector("d16");
+    CHECK(d16.type == VectorType::DECIMAL128);
+    CHECK_EQ(d16.value_width, size_t{16});
+    CHECK_EQ(d16.size, size_t{200});
+    CHECK_EQ(d16.scale, 6);
+    CHECK_EQ(d16.precision, 38);
+    for (int i = 0; i < 200 && static_cast<size_t>(i) < d16.size; i++) {
+        i128 v;
+        std::memcpy(&v, d16.fixed(static_cast<size_t>(i)), sizeof(v));
+        CHECK_EQ(str(v), str(expected_d16(i)));
+    }
+
+    // Plain FLBA keeps its bytes
+    ColumnVector raw = reader.read_column_vector("raw");
+    CHECK(raw.type == VectorType::FIXED_BYTES);
+    CHECK_EQ(raw.value_width, size_t{3});
+    CHECK_EQ(raw.size, size_t{200});
+    for (int i = 0; i < 200 && static_cast<size_t>(i) < raw.size; i++) {
+        const uint8_t* b = raw.fixed(static_cast<size_t>(i));
+        CHECK_EQ(int{b[0]}, i);
+        CHECK_EQ(int{b[1]}, 7);
+        CHECK_EQ(int{b[2]}, 255 - i);
+    }
+}
+
+void check_values(ParquetReader& reader) {
+    // The Value path returns FLBA values as their raw bytes
+    auto raw = reader.read_column("raw");
+    CHECK_EQ(raw.size(), size_t{200});
+    for (size_t i = 0; i < raw.size(); i++) {
+        auto b = static_cast<uint8_t>(i);
+        std::string expected{static_cast<char>(b), 7, static_cast<char>(255 - b)};
+        CHECK(raw[i].str() == expected);
+    }
+    auto d5 = reader.read_column("d5");
+    CHECK_EQ(d5.size(), size_t{200});
+    if (d5.size() > 4) {
+        CHECK(d5[3].is_null);
+        CHECK_EQ(d5[4].str().size(), size_t{5});
+    }
+}
+
+// Big-endian two's complement, one byte at a time
+i128 reference_be(const uint8_t* p, size_t width) {
+    i128 v = static_cast<int8_t>(p[0]);
+    for (size_t k = 1; k < width; k++) v = v * 256 + p[k];
+    return v;
+}
+
+void check_kernels() {
+    uint32_t state = 99;
+    for (size_t width = 1; width <= 16; width++) {
+        const size_t count = 50;
+        std::vector<uint8_t> src(width * count);
+        for (auto& b : src) {
+            state = state * 1103515245u + 12345u;
+            b = static_cast<uint8_t>(state >> 24);
+        }
+        // The sign bit set and clear, and all ones
+        src[0] = 0x80;
+        src[width] = 0x7F;
+        std::memset(src.data() + 2 * width, 0xFF, width);
+
+        std::vector<i128> wide(count);
+        decode_decimal128(src.data(), width, count, wide.data());
+        for (size_t i = 0; i < count; i++) {
+            CHECK_EQ(str(wide[i]), str(reference_be(src.data() + i * width, width)));
+        }
+        if (width <= 8) {
+            std::vector<int64_t> narrow(count);
+            decode_decimal64(src.data(), width, count, narrow.data());
+            for (size_t i = 0; i < count; i++) {
+                CHECK_EQ(str(narrow[i]), str(reference_be(src.data() + i * width, width)));
+            }
+        } else {
+            std::vector<int64_t> narrow(1);
+            CHECK_THROWS(decode_decimal64(src.data(), width, 1, narrow.data()));
+        }
+    }
+    std::vector<i128> one(1);
+    CHECK_THROWS(decode_decimal128(nullptr, 17, 0, one.data()));
+
+    CHECK_EQ(decimal_to_string(12345, 2), "123.45");
+    CHECK_EQ(decimal_to_string(-5, 3), "-0.005");
+    CHECK_EQ(decimal_to_string(100, 0), "100");
+    CHECK_EQ(decimal_to_string(0, 2), "0.00");
+    CHECK_EQ(decimal_to_string(INT128_MIN_, 0), "-170141183460469231731687303715884105728");
+    CHECK_EQ(decimal_to_string(INT128_MAX_, 38), "1.70141183460469231731687303715884105727");
+}
+
+} // namespace
+
+int main() {
+    check_kernels();
+    ParquetReader reader;
+    if (!open_fixture(reader, "decimals.parquet")) return test_result();
+    check_vectors(reader);
+    check_values(reader);
+    return test_result();
+}
@@ -0,0 +1,238 @@
+#include "test_util.hpp"
+#include "reader/delta_decoder.hpp"
+#include <climits>
+
+// Delta decoders, on the examples from the Parquet encodings spec and on
+// streams built here by a small reference encoder. No fixtures.
+
+namespace {
+
+void put_varint(std::vector<uint8_t>& out, uint64_t v) {
+    while (v >= 0x80) {
+        out.push_back(static_cast<uint8_t>(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(v));
+}
+
+void put_zigzag(std::vector<uint8_t>& out, int64_t v) {
+    put_varint(out, (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63));
+}
+
+// DELTA_BINARY_PACKED with blocks of 128 values in 4 miniblocks of 32
+std::vector<uint8_t> encode_delta(const std::vector<int64_t>& values) {
+    constexpr size_t BLOCK = 128, MINIBLOCK = 32;
+    std::vector<uint8_t> out;
+    put_varint(out, BLOCK);
+    put_varint(out, BLOCK / MINIBLOCK);
+    put_varint(out, values.size());
+    put_zigzag(out, values.empty() ? 0 : values[0]);
+    for (size_t start = 1; start < values.size(); start += BLOCK) {
+        size_t end = std::min(values.size(), start + BLOCK);
+        std::vector<uint64_t> deltas;
+        for (size_t i = start; i < end; i++) {
+            uint64_t d = static_cast<uint64_t>(values[i]) - static_cast<uint64_t>(values[i - 1]);
+            deltas.push_back(d);
+        }
+        int64_t min_delta = static_cast<int64_t>(deltas[0]);
+        for (uint64_t d : deltas) min_delta = std::min(min_delta, static_cast<int64_t>(d));
+        for (uint64_t& d : deltas) d -= static_cast<uint64_t>(min_delta);
+        deltas.resize(BLOCK, 0);
+
+        put_zigzag(out, min_delta);
+        std::vector<uint8_t> widths;
+        for (size_t m = 0; m < BLOCK; m += MINIBLOCK) {
+            uint64_t all = 0;
+            for (size_t i = m; i < m + MINIBLOCK; i++) all |= deltas[i];
+            uint8_t width = 0;
+            while (width < 64 && (all >> width) != 0) width++;
+            widths.push_back(width);
+        }
+        out.insert(out.end(), widths.begin(), widths.end());
+        for (size_t m = 0; m < BLOCK / MINIBLOCK; m++) {
+            std::vector<uint8_t> packed(MINIBLOCK * widths[m] / 8, 0);
+            for (size_t i = 0; i < MINIBLOCK; i++) {
+                for (uint8_t b = 0; b < widths[m]; b++) {
+                    size_t bit = i * widths[m] + b;
+                    if ((deltas[m * MINIBLOCK + i] >> b) & 1) packed[bit / 8] |= 1u << (bit % 8);
+                }
+            }
+            out.insert(out.end(), packed.begin(), packed.end());
+        }
+    }
+    return out;
+}
+
+std::vector<uint8_t> encode_length_byte_array(const std::vector<std::string>& values) {
+    std::vector<int64_t> lengths;
+    for (const auto& v : values) lengths.push_back(static_cast<int64_t>(v.size()));
+    auto out = encode_delta(lengths);
+    for (const auto& v : values) out.insert(out.end(), v.begin(), v.end());
+    return out;
+}
+
+std::vector<uint8_t> encode_byte_array(const std::vector<std::string>& values) {
+    std::vector<int64_t> prefixes;
+    std::vector<std::string> suffixes;
+    std::string prev;
+    for (const auto& v : values) {
+        size_t p = 0;
+        while (p < prev.size() && p < v.size() && prev[p] == v[p]) p++;
+        prefixes.push_back(static_cast<int64_t>(p));
+        suffixes.push_back(v.substr(p));
+        prev = v;
+    }
+    auto out = encode_delta(prefixes);
+    auto rest = encode_length_byte_array(suffixes);
+    out.insert(out.end(), rest.begin(), rest.end());
+    return out;
+}
+
+template <typename T>
+std::vector<T> decode_delta(const std::vector<uint8_t>& data,
+                            std::initializer_list<uint32_t> batches) {
+    DeltaBinaryPackedDecoder decoder(data.data(), static_cast<uint32_t>(data.size()));
+    std::vector<T> out(decoder.total_values());
+    uint32_t done = 0;
+    for (uint32_t n : batches) {
+        n = std::min(n, decoder.values_left());
+        decoder.get_batch(out.data() + done, n);
+        done += n;
+    }
+    decoder.get_batch(out.data() + done, decoder.values_left());
+    CHECK_EQ(decoder.values_left(), uint32_t{0});
+    CHECK(decoder.position() == data.data() + data.size());
+    return out;
+}
+
+std::string joined(const ByteArrayBuffer& buf, size_t from = 0) {
+    std::string out;
+    for (size_t i = from; i < buf.size(); i++) out += std::string(buf.view(i)) + "|";
+    return out;
+}
+
+std::string joined(const std::vector<std::string>& values) {
+    std::string out;
+    for (const auto& v : values) out += v + "|";
+    return out;
+}
+
+void check_spec_examples() {
+    // 1, 2, 3, 4, 5: one delta of 1, bit width 0
+    std::vector<uint8_t> ones = {0x80, 0x01, 0x04, 0x05, 0x02, 0x02, 0, 0, 0, 0};
+    DeltaBinaryPackedDecoder a(ones.data(), static_cast<uint32_t>(ones.size()));
+    std::vector<int32_t> got(5);
+    a.get_batch(got.data(), 5);
+    CHECK_EQ(got[0], 1);
+    CHECK_EQ(got[4], 5);
+    CHECK_THROWS(a.get_batch(got.data(), 1));
+
+    // 7, 5, 3, 1, 2, 3, 4, 5: min delta -2, relative deltas 0 0 0 3 3 3 3
+    // packed at 2 bits in the first miniblock
+    std::vector<uint8_t> mixed = {0x80, 0x01, 0x04, 0x08, 0x0E, 0x03, 2, 0, 0, 0,
+                                  0xC0, 0x3F, 0, 0, 0, 0, 0, 0};
+    auto values = decode_delta<int64_t>(mixed, {});
+    std::vector<int64_t> expected = {7, 5, 3, 1, 2, 3, 4, 5};
+    CHECK(values == expected);
+}
+
+void check_round_trip() {
+    // Several blocks, a partial last miniblock, mixed-sign deltas
+    std::vector<int64_t> values;
+    uint64_t state = 12345;
+    for (int i = 0; i < 1000; i++) {
+        state = state * 6364136223846793005u + 1442695040888963407u;
+        values.push_back(static_cast<int64_t>(state >> 40) - (int64_t{1} << 23));
+    }
+    auto data = encode_delta(values);
+    // Batches that start and end inside miniblocks and blocks
+    CHECK(decode_delta<int64_t>(data, {1, 7, 33, 100, 128, 300}) == values);
+    CHECK(decode_delta<int64_t>(data, {1000}) == values);
+
+    // The same stream read as INT32
+    std::vector<int32_t> narrow(values.begin(), values.end());
+    CHECK(decode_delta<int32_t>(data, {5, 64}) == narrow);
+
+    // Deltas needing all 64 bits wrap modulo 2^64
+    std::vector<int64_t> extremes = {INT64_MAX, INT64_MIN, 0, INT64_MAX, -1, INT64_MIN};
+    CHECK(decode_delta<int64_t>(encode_delta(extremes), {2}) == extremes);
+    std::vector<int64_t> int32s = {INT32_MAX, INT32_MIN, INT32_MAX, 0};
+    std::vector<int32_t> narrow32 = {INT32_MAX, INT32_MIN, INT32_MAX, 0};
+    CHECK(decode_delta<int32_t>(encode_delta(int32s), {}) == narrow32);
+
+    // A lone first value and an empty stream
+    CHECK(decode_delta<int64_t>(encode_delta({-42}), {}) == std::vector<int64_t>{-42});
+    CHECK(decode_delta<int64_t>(encode_delta({}), {}).empty());
+}
+
+void check_bad_layout() {
+    // 128 values in 3 miniblocks do not divide evenly
+    std::vector<uint8_t> uneven = {0x80, 0x01, 0x03, 0x01, 0x00};
+    CHECK_THROWS(DeltaBinaryPackedDecoder(uneven.data(), static_cast<uint32_t>(uneven.size())));
+    // Miniblocks of 4 values are not a multiple of 8
+    std::vector<uint8_t> small = {0x08, 0x02, 0x01, 0x00};
+    CHECK_THROWS(DeltaBinaryPackedDecoder(small.data(), static_cast<uint32_t>(small.size())));
+}
+
+void check_length_byte_array() {
+    std::vector<std::string> values = {"Hello", "World", "Foobar", "", "ABCDEF"};
+    for (int i = 0; i < 200; i++) {
+        values.push_back(std::string(static_cast<size_t>(i % 17), static_cast<char>('a' + i % 26)));
+    }
+    auto data = encode_length_byte_array(values);
+    DeltaLengthByteArrayDecoder decoder(data.data(), static_cast<uint32_t>(data.size()));
+    CHECK_EQ(decoder.values_left(), static_cast<uint32_t>(values.size()));
+
+    // Appends after what the buffer already holds
+    ByteArrayBuffer out;
+    out.append("x", 1);
+    decoder.decode(out, 3);
+    decoder.decode(out, 0);
+    decoder.decode(out, decoder.values_left());
+    CHECK_EQ(out.size(), values.size() + 1);
+    CHECK_EQ(std::string(out.view(0)), "x");
+    CHECK_EQ(joined(out, 1), joined(values));
+    CHECK_THROWS(decoder.decode(out, 1));
+
+    // Lengths running past the page are rejected up front
+    data.pop_back();
+    CHECK_THROWS(DeltaLengthByteArrayDecoder(data.data(), static_cast<uint32_t>(data.size())));
+}
+
+void check_byte_array() {
+    std::vector<std::string> values = {"axis", "axle", "babble", "babyhood", "", "b", "bab"};
+    for (int i = 0; i < 300; i++) values.push_back("key" + std::to_string(1000 + i * 7));
+    auto data = encode_byte_array(values);
+    DeltaByteArrayDecoder decoder(data.data(), static_cast<uint32_t>(data.size()));
+    CHECK_EQ(decoder.values_left(), static_cast<uint32_t>(values.size()));
+
+    // Split reads carry the previous value across calls
+    ByteArrayBuffer out;
+    decoder.decode(out, 2);
+    decoder.decode(out, 1);
+    decoder.decode(out, 150);
+    decoder.decode(out, decoder.values_left());
+    CHECK_EQ(out.size(), values.size());
+    CHECK_EQ(joined(out), joined(values));
+    CHECK_THROWS(decoder.decode(out, 1));
+
+    // A prefix longer than the value before it is corrupt
+    std::vector<int64_t> prefixes = {0, 5};
+    auto bad = encode_delta(prefixes);
+    auto suffixes = encode_length_byte_array({"ab", "c"});
+    bad.insert(bad.end(), suffixes.begin(), suffixes.end());
+    DeltaByteArrayDecoder corrupt(bad.data(), static_cast<uint32_t>(bad.size()));
+    ByteArrayBuffer sink;
+    CHECK_THROWS(corrupt.decode(sink, 2));
+}
+
+} // namespace
+
+int main() {
+    check_spec_examples();
+    check_round_trip();
+    check_bad_layout();
+    check_length_byte_array();
+    check_byte_array();
+    return test_result();
+}
@@ -0,0 +1,223 @@
+#include "reader/dictionary_cache.hpp"
+#include "test_util.hpp"
+#include <filesystem>
+#include <memory>
+#include <unistd.h>
+
+// int96.parquet: 60 rows in 2 row groups, cycling through the timestamps
+// of STAMPS (nanoseconds since the epoch).
+//   ts        INT96, dictionary encoded
+//   ts_plain  INT96, PLAIN
+// dictionary_a.parquet / dictionary_b.parquet: 40 rows in 2 row groups of
+// one dictionary encoded string column k, "a<i % 5>" / "bb<i % 5>".
+
+namespace {
+
+constexpr int64_t DAY = 86400LL * 1000000000LL;
+constexpr int64_t STAMPS[] = {0, 1, DAY - 1, 1700000000123456789LL, -1, -DAY - 5};
+constexpr int64_t JULIAN_EPOCH = 2440588;
+
+// Floor division, as the writer splits days
+std::string legacy_string(int64_t nanos) {
+    int64_t day = nanos / DAY - (nanos % DAY < 0);
+    int64_t in_day = nanos - day * DAY;
+    return "INT96(" + std::to_string(day + JULIAN_EPOCH) + ":" + std::to_string(in_day) + ")";
+}
+
+void check_int96(ParquetReader& reader, bool as_string) {
+    for (const char* col : {"ts", "ts_plain"}) {
+        auto values = reader.read_column(col);
+        CHECK_EQ(values.size(), size_t{60});
+        for (size_t i = 0; i < values.size(); i++) {
+            int64_t nanos = STAMPS[i % 6];
+            CHECK_EQ(values[i].to_string(),
+                     as_string ? legacy_string(nanos) : std::to_string(nanos));
+        }
+    }
+}
+
+// Readers sharing a cache, or one reader toggling the setting, each get
+// INT96 dictionaries in their own representation
+void check_int96_representation() {
+    auto cache = std::make_shared<DictionaryCache>();
+    ParquetReader nanos, strings;
+    nanos.set_dictionary_cache(cache);
+    strings.set_dictionary_cache(cache);
+    strings.set_int96_as_string(true);
+    if (!open_fixture(nanos, "int96.parquet") || !open_fixture(strings, "int96.parquet")) return;
+
+    check_int96(nanos, false);
+    size_t entries = cache->size();
+    CHECK(entries > 0);
+    check_int96(strings, true);
+    CHECK(cache->size() > entries);
+    check_int96(nanos, false);
+
+    nanos.set_int96_as_string(true);
+    check_int96(nanos, true);
+    nanos.set_int96_as_string(false);
+    check_int96(nanos, false);
+}
+
+using Key = DictionaryCache::Key;
+
+Key key(int row_group, int column = 0) {
+    Key k;
+    k.file = "/data/f.parquet";
+    k.size = 100;
+    k.mtime = 1;
+    k.row_group = row_group;
+    k.column = column;
+    return k;
+}
+
+ColumnVector dictionary(size_t bytes) {
+    ColumnVector v;
+    v.type = VectorType::FIXED_BYTES;
+    v.value_width = 1;
+    v.size = bytes;
+    v.data.assign(bytes, 1);
+    return v;
+}
+
+void check_entries() {
+    DictionaryCache cache;
+    CHECK(cache.find_vector(key(0)) == nullptr);
+    auto stored = cache.store_vector(key(0), dictionary(100));
+    CHECK(cache.find_vector(key(0)) == stored);
+    CHECK_EQ(cache.size(), size_t{1});
+    size_t entry = cache.memory_usage();
+    CHECK(entry >= 100);
+
+    // A second store for the key returns the first entry
+    auto again = cache.store_vector(key(0), dictionary(100));
+    CHECK(again == stored);
+    CHECK_EQ(cache.memory_usage(), entry);
+
+    // Every part of the key counts; Value and vector entries are separate
+    Key other = key(0);
+    other.mtime = 2;
+    CHECK(cache.find_vector(other) == nullptr);
+    other = key(0);
+    other.size = 101;
+    CHECK(cache.find_vector(other) == nullptr);
+    CHECK(cache.find_vector(key(0, 1)) == nullptr);
+    CHECK(cache.find_values(key(0)) == nullptr);
+    auto values = cache.store_values(key(0), {Value::from_string("x")});
+    CHECK(cache.find_values(key(0)) == values);
+    CHECK(cache.find_vector(key(0)) == stored);
+    CHECK_EQ(cache.size(), size_t{2});
+
+    // clear() drops the entries, not what callers hold
+    cache.clear();
+    CHECK_EQ(cache.size(), size_t{0});
+    CHECK_EQ(cache.memory_usage(), size_t{0});
+    CHECK_EQ(stored->size, size_t{100});
+    CHECK(cache.find_vector(key(0)) == nullptr);
+}
+
+void check_eviction() {
+    DictionaryCache probe;
+    probe.store_vector(key(0), dictionary(100));
+    size_t entry = probe.memory_usage();
+
+    // Room for two entries: the least recently used one goes first
+    DictionaryCache cache(2 * entry);
+    auto first = cache.store_vector(key(0), dictionary(100));
+    cache.store_vector(key(1), dictionary(100));
+    CHECK(cache.find_vector(key(0)) == first);  // key(1) is now the oldest
+    cache.store_vector(key(2), dictionary(100));
+    CHECK_EQ(cache.size(), size_t{2});
+    CHECK(cache.find_vector(key(0)) != nullptr);
+    CHECK(cache.find_vector(key(1)) == nullptr);
+    CHECK(cache.find_vector(key(2)) != nullptr);
+    CHECK(cache.memory_usage() <= cache.budget());
+
+    // A dictionary over the whole budget is handed back uncached
+    auto big = cache.store_vector(key(3), dictionary(4 * entry));
+    CHECK(big != nullptr);
+    CHECK_EQ(big->size, 4 * entry);
+    CHECK(cache.find_vector(key(3)) == nullptr);
+    CHECK_EQ(cache.size(), size_t{2});
+
+    // Lowering the budget evicts down to it, oldest first
+    cache.find_vector(key(2));
+    cache.set_budget(entry);
+    CHECK_EQ(cache.budget(), entry);
+    CHECK_EQ(cache.size(), size_t{1});
+    CHECK(cache.find_vector(key(2)) != nullptr);
+    cache.set_budget(0);
+    CHECK_EQ(cache.size(), size_t{0});
+    CHECK_EQ(cache.memory_usage(), size_t{0});
+}
+
+std::vector<std::string> column_k(ParquetReader& reader) {
+    std::vector<std::string> out;
+    for (const auto& v : reader.read_column("k")) out.push_back(v.to_string());
+    ColumnVector vec = reader.read_column_vector("k");
+    for (size_t i = 0; i < vec.size; i++) CHECK(vec.string(i) == out[i]);
+    auto it = reader.column_iterator("k");
+    size_t n = 0;
+    while (it.has_next()) {
+        auto [pos, len, ptr] = it.next();
+        CHECK(pos < out.size() && std::string(ptr, len) == out[pos]);
+        n++;
+    }
+    CHECK_EQ(n, out.size());
+    return out;
+}
+
+void check_k(const std::vector<std::string>& values, const std::string& prefix) {
+    CHECK_EQ(values.size(), size_t{40});
+    for (size_t i = 0; i < values.size(); i++) {
+        CHECK_EQ(values[i], prefix + std::to_string(i % 5));
+    }
+}
+
+// Readers share decoded dictionaries, and a file rewritten in place is
+// never served the old ones
+void check_shared_and_rewritten() {
+    auto cache = std::make_shared<DictionaryCache>();
+    ParquetReader a, b;
+    a.set_dictionary_cache(cache);
+    b.set_dictionary_cache(cache);
+    if (!open_fixture(a, "dictionary_a.parquet") || !open_fixture(b, "dictionary_a.parquet")) {
+        return;
+    }
+    check_k(column_k(a), "a");
+    // One Value and one vector dictionary per row group
+    CHECK_EQ(cache->size(), size_t{4});
+    size_t usage = cache->memory_usage();
+    check_k(column_k(b), "a");
+    CHECK_EQ(cache->size(), size_t{4});
+    CHECK_EQ(cache->memory_usage(), usage);
+
+    namespace fs = std::filesystem;
+    fs::path path = fs::temp_directory_path() /
+                    ("dictionary_cache_" + std::to_string(::getpid()) + ".parquet");
+    fs::copy_file(fixture("dictionary_a.parquet"), path, fs::copy_options::overwrite_existing);
+    ParquetReader reader;
+    reader.set_dictionary_cache(cache);
+    if (reader.open(path.string())) {
+        check_k(column_k(reader), "a");
+        fs::copy_file(fixture("dictionary_b.parquet"), path,
+                      fs::copy_options::overwrite_existing);
+        ParquetReader rewritten;
+        rewritten.set_dictionary_cache(cache);
+        CHECK(rewritten.open(path.string()));
+        check_k(column_k(rewritten), "bb");
+    } else {
+        CHECK(false);
+    }
+    fs::remove(path);
+}
+
+} // namespace
+
+int main() {
+    check_entries();
+    check_eviction();
+    check_shared_and_rewritten();
+    check_int96_representation();
+    return test_result();
+}
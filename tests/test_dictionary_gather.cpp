@@ -0,0 +1,66 @@
+#include "test_util.hpp"
+#include "reader/dictionary_gather.hpp"
+#include <algorithm>
+#include <cstring>
+
+// Dictionary gathers: the dispatched kernels (AVX2 for widths 4 and 8 on
+// x86) and the scalar loop, against values copied by hand. No fixtures.
+
+namespace {
+
+uint32_t next(uint32_t& state) {
+    state = state * 1103515245u + 12345u;
+    return state >> 8;
+}
+
+void check(size_t width, size_t dict_size, size_t count) {
+    uint32_t state = static_cast<uint32_t>(width * 131 + dict_size * 7 + count);
+    // Sized exactly, so a kernel reading past the last entry shows up
+    // under a sanitizer
+    std::vector<uint8_t> dict(width * dict_size);
+    for (auto& b : dict) b = static_cast<uint8_t>(next(state));
+    std::vector<uint32_t> indices(count);
+    for (size_t i = 0; i < count; i++) {
+        // The first and last entries, and everything between
+        indices[i] = i % 5 == 0 ? 0
+                   : i % 5 == 1 ? static_cast<uint32_t>(dict_size - 1)
+                                : next(state) % static_cast<uint32_t>(dict_size);
+    }
+    std::vector<uint8_t> expected(width * count);
+    for (size_t i = 0; i < count; i++) {
+        std::memcpy(expected.data() + i * width, dict.data() + indices[i] * width, width);
+    }
+
+    std::vector<uint8_t> fast(width * count + 1, 0xEE), scalar(width * count, 0xEE);
+    dictionary_gather(dict.data(), width, indices.data(), count, fast.data() + 1);
+    dictionary_gather_scalar(dict.data(), width, indices.data(), count, scalar.data());
+    bool fast_ok = std::equal(fast.begin() + 1, fast.end(), expected.begin());
+    bool scalar_ok = scalar == expected;
+    if (!fast_ok || !scalar_ok) {
+        std::cerr << "width " << width << ", " << dict_size << " entries, " << count
+                  << " indices\n";
+    }
+    CHECK(fast_ok);
+    CHECK(scalar_ok);
+    CHECK_EQ(int{fast[0]}, 0xEE);
+
+    uint32_t max = 0;
+    for (uint32_t idx : indices) max = std::max(max, idx);
+    CHECK_EQ(max_dictionary_index(indices.data(), count), max);
+}
+
+} // namespace
+
+int main() {
+    CHECK_EQ(max_dictionary_index(nullptr, 0), uint32_t{0});
+    // Counts below, at and past the 8- and 16-value kernel loops, and
+    // indices past 16 bits
+    for (size_t width : {1, 2, 3, 4, 8, 12, 16}) {
+        for (size_t dict_size : {1, 2, 255, 70000}) {
+            for (size_t count : {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 100, 1001}) {
+                check(width, dict_size, count);
+            }
+        }
+    }
+    return test_result();
+}
@@ -0,0 +1,85 @@
+#include "test_util.hpp"
+#include "reader/int96.hpp"
+#include <cstdint>
+#include <cstring>
+
+// int96.parquet: 60 rows in 2 row groups, cycling through the timestamps
+// of STAMPS (nanoseconds since the epoch).
+//   ts        INT96, dictionary encoded
+//   ts_plain  INT96, PLAIN
+//   ts_opt    INT96, dictionary encoded, null where row % 4 == 1
+
+namespace {
+
+constexpr int64_t DAY = 86400LL * 1000000000LL;
+constexpr int64_t STAMPS[] = {0, 1, DAY - 1, 1700000000123456789LL, -1, -DAY - 5};
+
+std::vector<uint8_t> int96(int64_t nanos_of_day, int32_t julian_day) {
+    std::vector<uint8_t> out(12);
+    std::memcpy(out.data(), &nanos_of_day, 8);
+    std::memcpy(out.data() + 8, &julian_day, 4);
+    return out;
+}
+
+void check_conversion() {
+    // Julian day 2440588 is 1970-01-01, 2451545 is 2000-01-01
+    CHECK_EQ(int96_to_nanos(int96(0, 2440588).data()), int64_t{0});
+    CHECK_EQ(int96_to_nanos(int96(0, 2451545).data()), 946684800LL * 1000000000LL);
+    CHECK_EQ(int96_to_nanos(int96(DAY - 1, 2440587).data()), int64_t{-1});
+    // 2023-11-14 22:13:20.123456789
+    CHECK_EQ(int96_to_nanos(int96(80000123456789LL, 2460263).data()), 1700000000123456789LL);
+
+    std::vector<uint8_t> packed;
+    for (int32_t day : {2440588, 2440589, 2440587}) {
+        auto v = int96(5, day);
+        packed.insert(packed.end(), v.begin(), v.end());
+    }
+    int64_t out[3];
+    decode_int96_nanos(packed.data(), 3, out);
+    CHECK_EQ(out[0], int64_t{5});
+    CHECK_EQ(out[1], DAY + 5);
+    CHECK_EQ(out[2], -DAY + 5);
+
+    // The last representable nanosecond, 2262-04-11 23:47:16.854775807, and
+    // the first past it
+    CHECK_EQ(int96_to_nanos(int96(85636854775807LL, 2547339).data()), INT64_MAX);
+    CHECK_THROWS(int96_to_nanos(int96(85636854775808LL, 2547339).data()));
+    // 0001-01-01 and 9999-12-31 overflow in the multiplication
+    CHECK_THROWS(int96_to_nanos(int96(0, 1721426).data()));
+    CHECK_THROWS(int96_to_nanos(int96(0, 5373484).data()));
+    auto sentinel = int96(0, 1721426);
+    CHECK_THROWS(decode_int96_nanos(sentinel.data(), 1, out));
+}
+
+void check_vectors(ParquetReader& reader) {
+    for (const char* col : {"ts", "ts_plain", "ts_opt"}) {
+        bool optional = std::string(col) == "ts_opt";
+        ColumnVector v = reader.read_column_vector(col);
+        CHECK(v.type == VectorType::TIMESTAMP_NS);
+        CHECK_EQ(v.value_width, size_t{8});
+        CHECK_EQ(v.size, size_t{60});
+        CHECK_EQ(v.null_count, optional ? size_t{15} : size_t{0});
+        for (size_t i = 0; i < v.size; i++) {
+            bool null = optional && i % 4 == 1;
+            CHECK_EQ(v.is_null(i), null);
+            CHECK_EQ(v.values<int64_t>()[i], null ? 0 : STAMPS[i % 6]);
+        }
+    }
+
+    // The Value path returns the same nanoseconds
+    auto values = reader.read_column("ts_opt");
+    CHECK_EQ(values.size(), size_t{60});
+    for (size_t i = 0; i < values.size(); i++) {
+        CHECK_EQ(values[i].to_string(), i % 4 == 1 ? "NULL" : std::to_string(STAMPS[i % 6]));
+    }
+}
+
+} // namespace
+
+int main() {
+    check_conversion();
+    ParquetReader reader;
+    if (!open_fixture(reader, "int96.parquet")) return test_result();
+    check_vectors(reader);
+    return test_result();
+}
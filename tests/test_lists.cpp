@@ -0,0 +1,211 @@
+#include "test_util.hpp"
+#include <optional>
+#include <utility>
+
+// lists.parquet: 120 rows in 3 row groups.
+//   id    INT32 row number
+//   tags  optional LIST of optional BYTE_ARRAY, written in 16-entry pages
+//         so lists span pages: see tag_row()
+// list_continuation.parquet: a malformed chunk whose first entry continues
+// a list (repetition level 1), followed by rows 1..9 of the same pattern.
+// nested_lists.parquet: 60 rows in 2 row groups of 10-entry pages.
+//   m  optional LIST of optional LIST of optional INT32: see nested_row()
+
+namespace {
+
+// Row i of tags: null, empty, or (i * 7) % 13 elements "t<i>_<j>", null
+// where (i + j) % 7 == 0
+std::optional<std::vector<std::optional<std::string>>> tag_row(int i) {
+    if (i % 11 == 3) return std::nullopt;
+    std::vector<std::optional<std::string>> row;
+    if (i % 11 == 5) return row;
+    for (int j = 0; j < (i * 7) % 13; j++) {
+        if ((i + j) % 7 == 0) {
+            row.emplace_back();
+        } else {
+            row.emplace_back("t" + std::to_string(i) + "_" + std::to_string(j));
+        }
+    }
+    return row;
+}
+
+// (row, string) of every non-null element in rows [first, last)
+std::vector<std::pair<size_t, std::string>> expected_strings(int first, int last) {
+    std::vector<std::pair<size_t, std::string>> out;
+    for (int i = first; i < last; i++) {
+        auto row = tag_row(i);
+        if (!row) continue;
+        for (const auto& s : *row) {
+            if (s) out.emplace_back(static_cast<size_t>(i), *s);
+        }
+    }
+    return out;
+}
+
+std::vector<std::pair<size_t, std::string>> iterate(ParquetReader& reader) {
+    std::vector<std::pair<size_t, std::string>> out;
+    auto it = reader.column_iterator("tags.list.element");
+    while (it.has_next()) {
+        auto [pos, len, ptr] = it.next();
+        out.emplace_back(pos, std::string(ptr, len));
+    }
+    return out;
+}
+
+void check_iterator() {
+    ParquetReader reader;
+    if (!open_fixture(reader, "lists.parquet")) return;
+    auto found = iterate(reader);
+    auto expected = expected_strings(0, 120);
+    CHECK_EQ(found.size(), expected.size());
+    for (size_t i = 0; i < found.size() && i < expected.size(); i++) {
+        if (found[i] != expected[i]) {
+            std::cerr << "element " << i << ": row " << found[i].first << " \""
+                      << found[i].second << "\", expected row " << expected[i].first << " \""
+                      << expected[i].second << "\"\n";
+            test_failures++;
+            break;
+        }
+    }
+
+    // Entries before the chunk's first new row go to its first row
+    ParquetReader malformed;
+    if (!open_fixture(malformed, "list_continuation.parquet")) return;
+    found = iterate(malformed);
+    expected = expected_strings(1, 10);
+    expected.insert(expected.begin(), {{0, "c0"}, {0, "c1"}});
+    CHECK_EQ(found.size(), expected.size());
+    for (size_t i = 0; i < found.size() && i < expected.size(); i++) {
+        CHECK_EQ(found[i].first, expected[i].first);
+        CHECK_EQ(found[i].second, expected[i].second);
+    }
+}
+
+// Row i of m: null, empty, or i % 4 + 1 inner lists, each null, empty or
+// holding (i + j) % 3 + 1 values i * 10 + j * 3 + k, null at k == 1 in even
+// rows
+using Inner = std::optional<std::vector<std::optional<int32_t>>>;
+std::optional<std::vector<Inner>> nested_row(int i) {
+    if (i % 9 == 2) return std::nullopt;
+    std::vector<Inner> row;
+    if (i % 9 == 4) return row;
+    for (int j = 0; j < i % 4 + 1; j++) {
+        if ((i + j) % 5 == 3) {
+            row.emplace_back();
+        } else if ((i + j) % 5 == 1) {
+            row.emplace_back(std::vector<std::optional<int32_t>>{});
+        } else {
+            std::vector<std::optional<int32_t>> inner;
+            for (int k = 0; k < (i + j) % 3 + 1; k++) {
+                if (k == 1 && i % 2 == 0) {
+                    inner.emplace_back();
+                } else {
+                    inner.emplace_back(i * 10 + j * 3 + k);
+                }
+            }
+            row.emplace_back(inner);
+        }
+    }
+    return row;
+}
+
+// Rows as "[a, NULL, [b]]" text, built from the hand-written rows above...
+template <typename T>
+std::string render(const std::optional<T>& v);
+
+std::string render(const std::optional<std::string>& v) { return v ? *v : "NULL"; }
+std::string render(const std::optional<int32_t>& v) { return v ? std::to_string(*v) : "NULL"; }
+
+template <typename T>
+std::string render(const std::optional<std::vector<T>>& list) {
+    if (!list) return "NULL";
+    std::string out = "[";
+    for (size_t i = 0; i < list->size(); i++) out += (i ? ", " : "") + render((*list)[i]);
+    return out + "]";
+}
+
+// ...and from a ListVector's offsets, entry `i` of level `depth`
+std::string render(const ListVector& v, size_t depth, size_t i) {
+    const ListLevel& level = v.levels[depth];
+    if (level.is_null(i)) return "NULL";
+    std::string out = "[";
+    for (int32_t j = level.offsets[i]; j < level.offsets[i + 1]; j++) {
+        if (j > level.offsets[i]) out += ", ";
+        auto child = static_cast<size_t>(j);
+        if (depth + 1 < v.levels.size()) {
+            out += render(v, depth + 1, child);
+        } else if (v.values.is_null(child)) {
+            out += "NULL";
+        } else if (v.values.type == VectorType::INT32) {
+            out += std::to_string(v.values.values<int32_t>()[child]);
+        } else {
+            out += std::string(v.values.string(child));
+        }
+    }
+    return out + "]";
+}
+
+// Offsets start at zero, never decrease, and end at the next level's size
+void check_shape(const ListVector& v, size_t depth) {
+    CHECK_EQ(v.levels.size(), depth);
+    for (size_t d = 0; d < v.levels.size(); d++) {
+        const ListLevel& level = v.levels[d];
+        CHECK(level.nullable);
+        CHECK_EQ(level.offsets.size(), level.size + 1);
+        CHECK_EQ(level.offsets[0], 0);
+        bool sorted = true;
+        size_t nulls = 0;
+        for (size_t i = 0; i < level.size; i++) {
+            sorted = sorted && level.offsets[i] <= level.offsets[i + 1];
+            nulls += level.is_null(i);
+            if (level.is_null(i)) CHECK_EQ(level.length(i), size_t{0});
+        }
+        CHECK(sorted);
+        CHECK_EQ(level.null_count, nulls);
+        size_t below = d + 1 < v.levels.size() ? v.levels[d + 1].size : v.values.size;
+        CHECK_EQ(static_cast<size_t>(level.offsets[level.size]), below);
+    }
+}
+
+template <typename Row>
+void check_rows(const ListVector& v, int first, int last, Row row) {
+    CHECK_EQ(v.size(), static_cast<size_t>(last - first));
+    for (int i = first; i < last && static_cast<size_t>(i - first) < v.size(); i++) {
+        std::string found = render(v, 0, static_cast<size_t>(i - first));
+        std::string expected = render(row(i));
+        if (found != expected) {
+            std::cerr << "row " << i << ": " << found << ", expected " << expected << "\n";
+            test_failures++;
+        }
+    }
+}
+
+void check_list_vectors() {
+    ParquetReader reader;
+    if (!open_fixture(reader, "lists.parquet")) return;
+    ListVector tags = reader.read_list_vector("tags.list.element");
+    check_shape(tags, 1);
+    check_rows(tags, 0, 120, tag_row);
+    // One row group: rows 40..79
+    ListVector middle = reader.read_list_vector("tags.list.element", 1);
+    check_shape(middle, 1);
+    check_rows(middle, 40, 80, tag_row);
+
+    ParquetReader nested;
+    if (!open_fixture(nested, "nested_lists.parquet")) return;
+    ListVector m = nested.read_list_vector("m.list.element.list.element");
+    check_shape(m, 2);
+    CHECK(m.values.type == VectorType::INT32);
+    check_rows(m, 0, 60, nested_row);
+    ListVector second = nested.read_list_vector("m.list.element.list.element", 1);
+    check_shape(second, 2);
+    check_rows(second, 30, 60, nested_row);
+}
+
+} // namespace
+
+int main() {
+    check_iterator();
+    check_list_vectors();
+    return test_result();
+}
@@ -0,0 +1,105 @@
+#include "test_util.hpp"
+
+// sorted*.parquet: 500 rows in 5 row groups of 20-row pages, declared
+// sorted on k, with chunk statistics.
+//   k    INT32: 120 nulls, then (i / 30) * 3 for i = 0..379, so runs of 30
+//        equal keys cross page and row-group boundaries and the first row
+//        group is all null. The _desc files hold the keys descending with
+//        the nulls last.
+//   row  INT64 row number, not declared sorted
+// The _no_index files have no page index, so whole chunks are searched.
+// sorted_nan*.parquet: 400 rows in 4 row groups of 25-row pages, declared
+// sorted on v.
+//   v  DOUBLE row / 2 up to row 299, then NaN, which sorts last, so row
+//      group 3 and each of its pages have NaN bounds only.
+
+namespace {
+
+// First row that does not sort before `key`, by a scan of every row
+int64_t scan(const std::vector<Value>& keys, const Value& key, const SortingColumn& order,
+             const ColumnInfo& col) {
+    for (size_t i = 0; i < keys.size(); i++) {
+        const Value& v = keys[i];
+        bool before = v.is_null ? order.nulls_first
+                                : (order.descending ? compare_values(v, key, col) > 0
+                                                    : compare_values(v, key, col) < 0);
+        if (!before) return static_cast<int64_t>(i);
+    }
+    return static_cast<int64_t>(keys.size());
+}
+
+void check_file(const std::string& name, bool descending) {
+    ParquetReader reader;
+    if (!open_fixture(reader, name)) return;
+    auto order = reader.sort_order("k");
+    CHECK(order.has_value());
+    if (!order) return;
+    CHECK_EQ(order->descending, descending);
+    CHECK_EQ(order->nulls_first, !descending);
+    CHECK(!reader.sort_order("row"));
+
+    const ColumnInfo& col = reader.column("k");
+    auto keys = reader.read_column("k");
+    CHECK_EQ(keys.size(), size_t{500});
+    for (int32_t key = -1; key <= 39; key++) {
+        int64_t expected = scan(keys, Value::from_i32(key), *order, col);
+        int64_t found = reader.lower_bound("k", Value::from_i32(key));
+        if (found != expected) {
+            std::cerr << name << ": lower_bound(" << key << ") = " << found
+                      << ", expected " << expected << "\n";
+            test_failures++;
+        }
+        CHECK_EQ(reader.lower_bound("k", Value::from_i64(key)), expected);
+    }
+    CHECK_EQ(reader.lower_bound("k", Value::from_double(4.5)),
+             scan(keys, Value::from_double(4.5), *order, col));
+
+    CHECK_THROWS(reader.lower_bound("k", Value::null()));
+    CHECK_THROWS(reader.lower_bound("row", Value::from_i64(3)));
+}
+
+// Row groups and pages whose bounds are all NaN are read instead
+void check_nan_file(const std::string& name) {
+    ParquetReader reader;
+    if (!open_fixture(reader, name)) return;
+    CHECK(!reader.column_statistics("v", 3).has_min_max());
+
+    auto order = reader.sort_order("v");
+    CHECK(order.has_value());
+    if (!order) return;
+    const ColumnInfo& col = reader.column("v");
+    auto values = reader.read_column("v");
+    CHECK_EQ(values.size(), size_t{400});
+    for (int twice = -2; twice <= 310; twice++) {
+        Value key = Value::from_double(twice / 2.0);
+        CHECK_EQ(reader.lower_bound("v", key), scan(values, key, *order, col));
+    }
+    // Past every number, the bound is the first NaN
+    CHECK_EQ(reader.lower_bound("v", Value::from_double(1000)), int64_t{300});
+}
+
+} // namespace
+
+int main() {
+    check_file("sorted.parquet", false);
+    check_file("sorted_no_index.parquet", false);
+    check_file("sorted_desc.parquet", true);
+    check_file("sorted_desc_no_index.parquet", true);
+    check_nan_file("sorted_nan.parquet");
+    check_nan_file("sorted_nan_no_index.parquet");
+
+    // Spot checks of the ascending layout: nulls first, then runs of 30
+    ParquetReader reader;
+    if (!open_fixture(reader, "sorted.parquet")) return test_result();
+    CHECK_EQ(reader.lower_bound("k", Value::from_i32(-5)), int64_t{120});
+    CHECK_EQ(reader.lower_bound("k", Value::from_i32(3)), int64_t{150});
+    CHECK_EQ(reader.lower_bound("k", Value::from_i32(4)), int64_t{180});
+    CHECK_EQ(reader.lower_bound("k", Value::from_i32(1000)), int64_t{500});
+
+    // Files that declare no order can't be searched
+    ParquetReader unsorted;
+    if (!open_fixture(unsorted, "stats.parquet")) return test_result();
+    CHECK_THROWS(unsorted.lower_bound("x", Value::from_i32(3)));
+
+    return test_result();
+}
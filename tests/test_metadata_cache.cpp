@@ -0,0 +1,115 @@
+#include "reader/metadata_cache.hpp"
+#include "test_util.hpp"
+#include <chrono>
+#include <filesystem>
+#include <memory>
+
+// Opens copies of wide.parquet and stats.parquet (see test_projection.cpp
+// and test_statistics.cpp) in a scratch directory, so one can be rewritten.
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::string first_values(ParquetReader& reader, const std::string& col) {
+    std::string out;
+    auto values = reader.read_column(col);
+    for (size_t i = 0; i < values.size() && i < 5; i++) out += values[i].to_string() + " ";
+    return out;
+}
+
+void run(const fs::path& dir) {
+    const std::string wide = (dir / "wide.parquet").string();
+    const std::string stats = (dir / "stats.parquet").string();
+    fs::copy_file(fixture("wide.parquet"), wide);
+    fs::copy_file(fixture("stats.parquet"), stats);
+
+    auto cache = std::make_shared<MetadataCache>();
+    ParquetReader first;
+    first.set_metadata_cache(cache);
+    CHECK(first.open(wide));
+    CHECK_EQ(cache->misses(), uint64_t{1});
+    CHECK_EQ(cache->hits(), uint64_t{0});
+    CHECK_EQ(cache->size(), size_t{1});
+
+    // A second reader gets the parsed file without reading the footer
+    ParquetReader second;
+    second.set_metadata_cache(cache);
+    CHECK(second.open(wide));
+    CHECK_EQ(cache->hits(), uint64_t{1});
+    CHECK_EQ(first_values(second, "c2"), "2 12 22 32 42 ");
+    CHECK_EQ(first_values(second, "tag"), first_values(first, "tag"));
+
+    // Chunks decoded after open() are charged to the cache
+    size_t before = cache->memory_usage();
+    first.metadata();
+    CHECK(cache->memory_usage() > before);
+
+    // Projected opens bypass the cache
+    ParquetReader projected;
+    projected.set_metadata_cache(cache);
+    projected.set_projection({"c0"});
+    CHECK(projected.open(wide));
+    CHECK_EQ(cache->hits() + cache->misses(), uint64_t{2});
+
+    // A file rewritten in place with a new mtime is parsed again
+    fs::last_write_time(wide, fs::last_write_time(wide) + std::chrono::hours(1));
+    ParquetReader rewritten;
+    rewritten.set_metadata_cache(cache);
+    CHECK(rewritten.open(wide));
+    CHECK_EQ(cache->misses(), uint64_t{2});
+    CHECK_EQ(cache->size(), size_t{2});
+
+    // Least recently used entries go first when the budget shrinks
+    cache->clear();
+    CHECK_EQ(cache->size(), size_t{0});
+    CHECK_EQ(cache->memory_usage(), size_t{0});
+    ParquetReader a, b;
+    a.set_metadata_cache(cache);
+    b.set_metadata_cache(cache);
+    CHECK(a.open(wide));
+    a.metadata();  // grows the entry after it was inserted
+    size_t grown = cache->memory_usage();
+    CHECK(b.open(stats));
+    CHECK_EQ(cache->size(), size_t{2});
+    size_t both = cache->memory_usage();
+    cache->set_budget(both - 1);
+    CHECK_EQ(cache->size(), size_t{1});
+    // Evicting an entry takes off its growth too
+    CHECK_EQ(cache->memory_usage(), both - grown);
+    // ...and it is not charged for growth once evicted
+    CHECK_EQ(first_values(a, "c3"), "3 13 23 33 43 ");
+    CHECK_EQ(cache->memory_usage(), both - grown);
+    uint64_t hits = cache->hits();
+    CHECK(b.open(stats));
+    CHECK_EQ(cache->hits(), hits + 1);
+    // The evicted entry stays usable by the reader holding it
+    CHECK_EQ(first_values(a, "c1"), "1 11 21 31 41 ");
+
+    // A file larger than the whole budget is not cached
+    cache->clear();
+    cache->set_budget(1);
+    CHECK(a.open(wide));
+    CHECK_EQ(cache->size(), size_t{0});
+    CHECK_EQ(first_values(a, "c1"), "1 11 21 31 41 ");
+
+    CHECK(MetadataCache::global() == MetadataCache::global());
+    CHECK_EQ(MetadataCache::global()->budget(), MetadataCache::DEFAULT_BUDGET);
+}
+
+} // namespace
+
+int main() {
+    fs::path dir = fs::temp_directory_path() /
+                   ("parquet_metadata_cache_" + std::to_string(
+                        std::chrono::steady_clock::now().time_since_epoch().count()));
+    fs::create_directories(dir);
+    try {
+        run(dir);
+    } catch (const std::exception& e) {
+        std::cerr << "unexpected exception: " << e.what() << "\n";
+        test_failures++;
+    }
+    fs::remove_all(dir);
+    return test_result();
+}
@@ -0,0 +1,226 @@
+#include "test_util.hpp"
+#include "reader/page_header_cache.hpp"
+#include <thread>
+
+// CachedPageHeader against the PageHeaders it is built from, and
+// PageHeaderCache on its own. Real headers come from snappy.parquet (see
+// test_compression.cpp), with dictionary pages and CRCs, and
+// v2_snappy.parquet, whose DATA_PAGE_V2 pages leave every third page's
+// values uncompressed.
+
+namespace {
+
+bool same_header(const PageHeader& a, const PageHeader& b) {
+    if (a.type != b.type || a.uncompressed_page_size != b.uncompressed_page_size ||
+        a.compressed_page_size != b.compressed_page_size || a.crc != b.crc ||
+        a.data_page_header.has_value() != b.data_page_header.has_value() ||
+        a.dictionary_page_header.has_value() != b.dictionary_page_header.has_value() ||
+        a.data_page_header_v2.has_value() != b.data_page_header_v2.has_value()) {
+        return false;
+    }
+    if (const auto& x = a.data_page_header) {
+        const auto& y = *b.data_page_header;
+        return x->num_values == y.num_values && x->encoding == y.encoding &&
+               x->definition_level_encoding == y.definition_level_encoding &&
+               x->repetition_level_encoding == y.repetition_level_encoding;
+    }
+    if (const auto& x = a.dictionary_page_header) {
+        const auto& y = *b.dictionary_page_header;
+        return x->num_values == y.num_values && x->encoding == y.encoding &&
+               x->is_sorted == y.is_sorted;
+    }
+    if (const auto& x = a.data_page_header_v2) {
+        // The null and row counts are not kept
+        const auto& y = *b.data_page_header_v2;
+        return x->num_values == y.num_values && x->encoding == y.encoding &&
+               x->definition_levels_byte_length == y.definition_levels_byte_length &&
+               x->repetition_levels_byte_length == y.repetition_levels_byte_length &&
+               x->is_compressed == y.is_compressed;
+    }
+    return true;
+}
+
+void check_round_trip() {
+    PageHeader data;
+    data.type = PageType::DATA_PAGE;
+    data.uncompressed_page_size = 4000;
+    data.compressed_page_size = 1234;
+    data.crc = -5;
+    auto& dph = data.data_page_header.emplace();
+    dph.num_values = 100;
+    dph.encoding = Encoding::RLE_DICTIONARY;
+    dph.definition_level_encoding = Encoding::BIT_PACKED;
+    dph.statistics.emplace();
+
+    PageHeader dict;
+    dict.type = PageType::DICTIONARY_PAGE;
+    dict.uncompressed_page_size = dict.compressed_page_size = 77;
+    auto& dph_dict = dict.dictionary_page_header.emplace();
+    dph_dict.num_values = 13;
+    dph_dict.is_sorted = true;
+
+    PageHeader v2;
+    v2.type = PageType::DATA_PAGE_V2;
+    v2.uncompressed_page_size = 600;
+    v2.compressed_page_size = 300;
+    v2.crc = 0;
+    auto& h2 = v2.data_page_header_v2.emplace();
+    h2.num_values = 50;
+    h2.encoding = Encoding::DELTA_BINARY_PACKED;
+    h2.definition_levels_byte_length = 9;
+    h2.repetition_levels_byte_length = 4;
+
+    PageHeader index;
+    index.type = PageType::INDEX_PAGE;
+    index.uncompressed_page_size = index.compressed_page_size = 8;
+
+    for (bool compressed : {true, false}) {
+        h2.is_compressed = compressed;
+        for (const PageHeader* h : {&data, &dict, &v2, &index}) {
+            CachedPageHeader page = CachedPageHeader::from(*h, 1000, 21);
+            CHECK(same_header(page.header(), *h));
+            CHECK_EQ(page.data_offset(), size_t{1021});
+            CHECK_EQ(page.end_offset(),
+                     size_t{1021} + static_cast<size_t>(h->compressed_page_size));
+        }
+    }
+    // Statistics are not kept
+    CHECK(!CachedPageHeader::from(data, 0, 0).header().data_page_header->statistics);
+
+    // Only data pages count towards the chunk's values, and only V2 pages
+    // have level bytes
+    CHECK_EQ(CachedPageHeader::from(data, 0, 0).data_values(), int64_t{100});
+    CHECK_EQ(CachedPageHeader::from(v2, 0, 0).data_values(), int64_t{50});
+    CHECK_EQ(CachedPageHeader::from(dict, 0, 0).data_values(), int64_t{0});
+    CHECK_EQ(CachedPageHeader::from(index, 0, 0).data_values(), int64_t{0});
+    CHECK_EQ(CachedPageHeader::from(data, 0, 0).levels_size(), size_t{0});
+    CHECK_EQ(CachedPageHeader::from(v2, 0, 0).levels_size(), size_t{13});
+
+    // A page whose type and header disagree contributes nothing
+    PageHeader mismatched = data;
+    mismatched.type = PageType::DATA_PAGE_V2;
+    CHECK_EQ(CachedPageHeader::from(mismatched, 0, 0).data_values(), int64_t{0});
+}
+
+// Headers decoded from a file agree with the page index, and each chunk's
+// data values add up to its num_values
+void check_file(const std::string& file) {
+    ParquetReader reader;
+    if (!open_fixture(reader, file)) return;
+    for (size_t rg = 0; rg < reader.num_row_groups(); rg++) {
+        for (const auto& info : reader.columns()) {
+            size_t col = static_cast<size_t>(info.column_index);
+            const ColumnMetaData* meta = reader.column_chunk_meta(rg, col);
+            std::vector<size_t> ids;
+            for (size_t id = 0; id < reader.num_pages(); id++) {
+                const auto& entry = reader.page_index_entry(id);
+                if (entry.row_group_idx == rg && entry.column_idx == col) ids.push_back(id);
+            }
+
+            // The walk starts at the dictionary page, if any, and ends
+            // with the chunk
+            size_t start = static_cast<size_t>(meta->dictionary_page_offset.value_or(
+                meta->data_page_offset));
+            size_t offset = start;
+            int64_t values = 0;
+            size_t data_pages = 0;
+            while (values < meta->num_values) {
+                auto buf = reader.read_range(offset, HEADER_READ_SIZE);
+                ThriftReader thrift(buf.data(), buf.size());
+                PageHeader header;
+                header.deserialize(thrift, true);
+                CachedPageHeader page = CachedPageHeader::from(header, offset, thrift.position());
+                CHECK(same_header(page.header(), header));
+                if (page.data_values() > 0 && data_pages < ids.size()) {
+                    const auto& entry = reader.page_index_entry(ids[data_pages++]);
+                    CHECK_EQ(page.offset, uint64_t{entry.page_offset});
+                    CHECK_EQ(page.data_offset(), entry.data_offset);
+                    CHECK_EQ(page.end_offset(), entry.page_offset + entry.page_size);
+                    CHECK_EQ(page.levels_size(), entry.levels_size);
+                    CHECK_EQ(!(page.flags & CachedPageHeader::VALUES_UNCOMPRESSED),
+                             entry.values_compressed);
+                    CHECK(page.crc == entry.crc.value_or(0));
+                    CHECK_EQ(bool(page.flags & CachedPageHeader::HAS_CRC), entry.crc.has_value());
+                }
+                values += page.data_values();
+                offset = page.end_offset();
+            }
+            CHECK_EQ(values, meta->num_values);
+            CHECK_EQ(data_pages, ids.size());
+            CHECK_EQ(offset, start + static_cast<size_t>(meta->total_compressed_size));
+        }
+    }
+}
+
+std::vector<CachedPageHeader> headers(int pages) {
+    std::vector<CachedPageHeader> out(static_cast<size_t>(pages));
+    for (int i = 0; i < pages; i++) out[static_cast<size_t>(i)].num_values = i;
+    return out;
+}
+
+void check_cache() {
+    GrowthTracker growth;
+    PageHeaderCache cache(&growth);
+    CHECK(cache.find({0, 0}) == nullptr);
+    CHECK_EQ(cache.size(), size_t{0});
+    CHECK_EQ(cache.memory_usage(), size_t{0});
+
+    // Keys differ by row group and by column
+    auto a = cache.store({0, 1}, headers(3));
+    auto b = cache.store({1, 0}, headers(5));
+    CHECK(a != nullptr && b != nullptr);
+    CHECK_EQ(a->size(), size_t{3});
+    CHECK_EQ(b->size(), size_t{5});
+    CHECK(cache.find({0, 1}) == a);
+    CHECK(cache.find({1, 0}) == b);
+    CHECK(cache.find({0, 0}) == nullptr);
+    CHECK(cache.find({1, 1}) == nullptr);
+    CHECK_EQ(cache.size(), size_t{2});
+
+    // Every stored entry is charged to the tracker
+    size_t used = cache.memory_usage();
+    CHECK(used >= 8 * sizeof(CachedPageHeader));
+    CHECK_EQ(growth.total(), used);
+
+    // The first store of a key wins, and is not charged again
+    auto again = cache.store({0, 1}, headers(40));
+    CHECK(again == a);
+    CHECK_EQ(again->size(), size_t{3});
+    CHECK_EQ(cache.memory_usage(), used);
+    CHECK_EQ(growth.total(), used);
+
+    // Entries outlive clear() while held; growth is never taken back
+    cache.clear();
+    CHECK_EQ(cache.size(), size_t{0});
+    CHECK_EQ(cache.memory_usage(), size_t{0});
+    CHECK(cache.find({0, 1}) == nullptr);
+    CHECK_EQ((*a)[2].num_values, 2);
+    CHECK_EQ(growth.total(), used);
+
+    // Concurrent walks of one chunk end up sharing a single entry
+    PageHeaderCache shared(&growth);
+    std::vector<PageHeaderCache::Headers> stored(8);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < stored.size(); t++) {
+        threads.emplace_back([&, t] { stored[t] = shared.store({2, 3}, headers(10)); });
+    }
+    for (auto& t : threads) t.join();
+    for (const auto& s : stored) CHECK(s == stored[0]);
+    CHECK_EQ(shared.size(), size_t{1});
+    CHECK_EQ(growth.total(), used + shared.memory_usage());
+
+    // A cache without a tracker still counts its own bytes
+    PageHeaderCache untracked;
+    untracked.store({0, 0}, headers(1));
+    CHECK(untracked.memory_usage() > 0);
+}
+
+} // namespace
+
+int main() {
+    check_round_trip();
+    check_cache();
+    check_file("snappy.parquet");
+    check_file("v2_snappy.parquet");
+    return test_result();
+}
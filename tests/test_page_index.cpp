@@ -0,0 +1,150 @@
+#include "test_util.hpp"
+#include <optional>
+#include <thread>
+
+// page_index.parquet: the data of stats.parquet (see test_statistics.cpp)
+// with a page index, in 4 row groups of 100 rows.
+//   s  BYTE_ARRAY, 50-row pages, written first
+//   x  INT32 = row, null for rows 300..399 and where row % 40 == 5, in
+//      25-row pages, so the pages of rows 300..399 are all null and the
+//      page of rows 125..149 starts at 126
+
+namespace {
+
+using P = ColumnPredicate;
+
+std::optional<int> x_at(int row) {
+    if (row >= 300 || row % 40 == 5) return std::nullopt;
+    return row;
+}
+
+// First rows of the x pages a predicate on [lo, hi] may match, or of the
+// pages holding nulls
+std::vector<size_t> expected_pages(std::optional<int> lo, std::optional<int> hi,
+                                   bool nulls = false) {
+    std::vector<size_t> out;
+    for (int first = 0; first < 400; first += 25) {
+        std::optional<int> min, max;
+        bool has_null = false;
+        for (int row = first; row < first + 25; row++) {
+            auto v = x_at(row);
+            if (!v) {
+                has_null = true;
+                continue;
+            }
+            if (!min) min = *v;
+            max = *v;
+        }
+        bool match = nulls ? has_null
+                           : min && (!lo || *max >= *lo) && (!hi || *min <= *hi);
+        if (match) out.push_back(static_cast<size_t>(first));
+    }
+    return out;
+}
+
+std::vector<size_t> first_rows(const ParquetReader& reader, const std::vector<size_t>& pages) {
+    std::vector<size_t> out;
+    for (size_t id : pages) {
+        const PageIndexEntry& entry = reader.page_index_entry(id);
+        CHECK_EQ(entry.column_idx, size_t{1});
+        out.push_back(static_cast<size_t>(entry.first_row));
+    }
+    return out;
+}
+
+void check_prune(const ParquetReader& reader, const ColumnPredicate& predicate,
+                 std::optional<int> lo, std::optional<int> hi, bool nulls = false) {
+    CHECK_EQ(list(first_rows(reader, reader.prune_pages("x", predicate))),
+             list(expected_pages(lo, hi, nulls)));
+}
+
+} // namespace
+
+int main() {
+    ParquetReader reader;
+    if (!open_fixture(reader, "page_index.parquet")) return test_result();
+
+    // Pages come from the OffsetIndex
+    CHECK_EQ(reader.num_pages(), size_t{4 * (2 + 4)});
+    const OffsetIndex* oi = reader.offset_index("x", 1);
+    CHECK(oi != nullptr);
+    if (oi) {
+        CHECK_EQ(oi->page_locations.size(), size_t{4});
+        for (size_t i = 0; i < oi->page_locations.size(); i++) {
+            CHECK_EQ(oi->page_locations[i].first_row_index, static_cast<int64_t>(i * 25));
+        }
+        // Global ids: per row group, the 2 pages of s, then the 4 of x
+        const PageIndexEntry& entry = reader.page_index_entry(6 + 2 + 1);
+        CHECK_EQ(entry.row_group_idx, size_t{1});
+        CHECK_EQ(entry.first_row, int64_t{125});
+        CHECK_EQ(entry.page_offset, static_cast<size_t>(oi->page_locations[1].offset));
+        CHECK_EQ(entry.page_size,
+                 static_cast<size_t>(oi->page_locations[1].compressed_page_size));
+        CHECK(entry.header_read);
+    }
+
+    const ColumnIndex* ci = reader.column_index("x", 3);
+    CHECK(ci != nullptr);
+    if (ci) {
+        CHECK_EQ(ci->null_pages.size(), size_t{4});
+        for (bool null_page : ci->null_pages) CHECK(null_page);
+        CHECK_EQ(ci->null_counts.size(), size_t{4});
+        if (!ci->null_counts.empty()) CHECK_EQ(ci->null_counts[0], int64_t{25});
+    }
+    ci = reader.column_index("x", 1);
+    CHECK(ci && ci->boundary_order == BoundaryOrder::ASCENDING);
+    if (ci) {
+        ColumnStatistics page = decode_page_statistics(*ci, 1, reader.column("x"));
+        CHECK(page.has_min_max());
+        if (page.has_min_max()) {
+            CHECK_EQ(page.min->to_string(), "126");
+            CHECK_EQ(page.max->to_string(), "149");
+        }
+        CHECK(page.null_count && *page.null_count == 1);
+    }
+
+    // Pruning agrees with the page bounds; 125 is null and in no page's range
+    for (int v = -1; v <= 400; v++) check_prune(reader, P::equal(Value::from_i32(v)), v, v);
+    CHECK_EQ(list(reader.prune_pages("x", P::equal(Value::from_i32(125)))), "{}");
+    check_prune(reader, P::less(Value::from_i32(60)), std::nullopt, 59);
+    check_prune(reader, P::greater_equal(Value::from_i32(240)), 240, std::nullopt);
+    check_prune(reader, P::between(Value::from_i32(110), Value::from_i32(180)), 110, 180);
+    check_prune(reader, P::is_null(), std::nullopt, std::nullopt, true);
+    CHECK_EQ(reader.prune_pages("x", P::is_not_null()).size(), size_t{12});
+
+    // Reading through the page index returns the same values as without it
+    ParquetReader plain;
+    if (!open_fixture(plain, "stats.parquet")) return test_result();
+    for (const char* col : {"x", "s"}) {
+        auto a = reader.read_column(col);
+        auto b = plain.read_column(col);
+        CHECK_EQ(a.size(), b.size());
+        for (size_t i = 0; i < a.size() && i < b.size(); i++) {
+            CHECK_EQ(a[i].to_string(), b[i].to_string());
+        }
+    }
+    CHECK(plain.offset_index("x", 0) == nullptr);
+    CHECK(plain.column_index("x", 0) == nullptr);
+    CHECK_EQ(plain.prune_pages("x", P::equal(Value::from_i32(150))).size(), size_t{4});
+
+    // Page headers resolved lazily by concurrent const reads
+    ParquetReader shared;
+    if (!open_fixture(shared, "page_index.parquet")) return test_result();
+    std::vector<std::vector<uint8_t>> pages;
+    for (size_t id = 0; id < reader.num_pages(); id++) pages.push_back(reader.read_page_data(id));
+    std::vector<size_t> mismatches(4);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < mismatches.size(); t++) {
+        threads.emplace_back([&, t] {
+            for (size_t i = 0; i < pages.size(); i++) {
+                size_t id = (i + t * 5) % pages.size();
+                const PageIndexEntry& entry = shared.page_index_entry(id);
+                if (!entry.header_read || shared.read_page_data(id) != pages[id]) mismatches[t]++;
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    for (size_t count : mismatches) CHECK_EQ(count, size_t{0});
+
+    return test_result();
+}
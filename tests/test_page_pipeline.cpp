@@ -0,0 +1,190 @@
+#include "test_util.hpp"
+#include "reader/page_pipeline.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <utility>
+
+// PagePipeline walks of single column chunks, against the page index and
+// ParquetReader::read_page_data(). snappy.parquet (see test_compression.cpp)
+// has a dictionary page ahead of the name chunks; v2_snappy.parquet mixes
+// compressed and uncompressed DATA_PAGE_V2 values; page_index.parquet (see
+// test_page_index.cpp) is uncompressed. crc.parquet and crc_corrupt.parquet
+// (see test_checksums.cpp) have six 50-row pages, the third one damaged in
+// crc_corrupt.parquet.
+
+namespace {
+
+// Global ids of the data pages of one chunk, in file order
+std::vector<size_t> chunk_pages(const ParquetReader& reader, size_t row_group, size_t column) {
+    std::vector<size_t> ids;
+    for (size_t id = 0; id < reader.num_pages(); id++) {
+        const auto& entry = reader.page_index_entry(id);
+        if (entry.row_group_idx == row_group && entry.column_idx == column) ids.push_back(id);
+    }
+    return ids;
+}
+
+struct Walk {
+    std::vector<PagePipeline::Page> pages;
+    size_t reads = 0;  // read_range calls
+};
+
+Walk walk(const ParquetReader& reader, size_t row_group, size_t column,
+          std::shared_ptr<ThreadPool> pool, size_t depth, PageHeaderCache* cache = nullptr,
+          bool skip_dictionary = false) {
+    Walk w;
+    auto reads = std::make_shared<std::atomic<size_t>>(0);
+    ReadRangeFunc read = [&reader, reads](size_t offset, size_t length) {
+        ++*reads;
+        return reader.read_range(offset, length);
+    };
+    PagePipeline pipeline(read, *reader.column_chunk_meta(row_group, column), std::move(pool),
+                          depth);
+    if (cache) pipeline.set_page_header_cache(cache, {row_group, column});
+    if (skip_dictionary) pipeline.skip_dictionary_page();
+    PagePipeline::Page page;
+    while (pipeline.next(page)) w.pages.push_back(page);
+    CHECK(!pipeline.next(page));
+    w.reads = *reads;
+    return w;
+}
+
+// The data pages of a walk match the page index and read_page_data();
+// returns whether the chunk has a dictionary page
+bool check_walk(const ParquetReader& reader, const Walk& w, size_t row_group, size_t column,
+                bool skip_dictionary) {
+    auto ids = chunk_pages(reader, row_group, column);
+    size_t first = 0;
+    bool dictionary = !w.pages.empty() && w.pages[0].header.type == PageType::DICTIONARY_PAGE;
+    if (dictionary) {
+        const auto& page = w.pages[0];
+        CHECK(page.header.dictionary_page_header.has_value());
+        size_t size = static_cast<size_t>(page.header.uncompressed_page_size);
+        CHECK_EQ(page.data.size(), skip_dictionary ? size_t{0} : size);
+        first = 1;
+    }
+    CHECK_EQ(w.pages.size() - first, ids.size());
+    for (size_t i = 0; i < ids.size() && first + i < w.pages.size(); i++) {
+        const auto& page = w.pages[first + i];
+        const auto& entry = reader.page_index_entry(ids[i]);
+        CHECK(page.header.type != PageType::DICTIONARY_PAGE);
+        CHECK_EQ(static_cast<size_t>(page.header.compressed_page_size), entry.data_size);
+        CHECK_EQ(static_cast<size_t>(page.header.uncompressed_page_size),
+                 entry.uncompressed_size);
+        CHECK(page.header.crc == entry.crc);
+        CHECK_EQ(page.data.size(), entry.payload_size());
+        if (page.data != reader.read_page_data(ids[i])) {
+            std::cerr << "row group " << row_group << ", column " << column << ": page "
+                      << ids[i] << " differs\n";
+            test_failures++;
+        }
+    }
+    return dictionary;
+}
+
+void check_file(const std::string& file) {
+    ParquetReader reader;
+    if (!open_fixture(reader, file)) return;
+    auto pool = std::make_shared<ThreadPool>(3);
+    size_t row_groups = reader.metadata().row_groups.size();
+    for (size_t rg = 0; rg < row_groups; rg++) {
+        for (const auto& info : reader.columns()) {
+            size_t col = static_cast<size_t>(info.column_index);
+            // Inline, and on a pool below, at and past the chunk's page count
+            // (depth 0 counts as 1)
+            Walk inline_walk = walk(reader, rg, col, nullptr, 0);
+            bool dictionary = check_walk(reader, inline_walk, rg, col, false);
+            for (size_t depth : {size_t{1}, size_t{3}, size_t{64}}) {
+                check_walk(reader, walk(reader, rg, col, pool, depth), rg, col, false);
+            }
+
+            // The dictionary payload is neither read nor decompressed when
+            // skipped
+            Walk skipped = walk(reader, rg, col, pool, 4, nullptr, true);
+            check_walk(reader, skipped, rg, col, true);
+            CHECK_EQ(skipped.reads, inline_walk.reads - (dictionary ? 1 : 0));
+
+            // The first walk records the headers; the next one reads only
+            // payloads, one read per page
+            PageHeaderCache cache;
+            Walk recorded = walk(reader, rg, col, pool, 2, &cache);
+            check_walk(reader, recorded, rg, col, false);
+            CHECK_EQ(recorded.reads, 2 * recorded.pages.size());
+            CHECK_EQ(cache.size(), size_t{1});
+            auto headers = cache.find({rg, col});
+            CHECK(headers != nullptr);
+            if (headers) CHECK_EQ(headers->size(), recorded.pages.size());
+            Walk cached = walk(reader, rg, col, pool, 2, &cache);
+            check_walk(reader, cached, rg, col, false);
+            CHECK_EQ(cached.reads, cached.pages.size());
+            CHECK(cache.find({rg, col}) == headers);
+        }
+    }
+}
+
+// Checksums are verified on the pool and inline alike, and a mismatch
+// surfaces from next() for the damaged page only
+void check_checksums(std::shared_ptr<ThreadPool> pool) {
+    PageChecksums checksums;
+    PagePipeline::Page page;
+    // Stored and decompressed pages: crc.parquet is uncompressed, the id
+    // chunk of snappy.parquet has five SNAPPY pages
+    for (auto [file, pages] : {std::pair{"crc.parquet", 6}, std::pair{"snappy.parquet", 5}}) {
+        ParquetReader reader;
+        if (!open_fixture(reader, file)) return;
+        ReadRangeFunc read = [&reader](size_t o, size_t n) { return reader.read_range(o, n); };
+        checksums.reset();
+        PagePipeline pipeline(read, *reader.column_chunk_meta(0, 0), pool, 4, &checksums);
+        int walked = 0;
+        while (pipeline.next(page)) walked++;
+        CHECK_EQ(walked, pages);
+        CHECK_EQ(checksums.verified.load(), static_cast<uint64_t>(pages));
+        CHECK_EQ(checksums.failed.load(), uint64_t{0});
+    }
+
+    ParquetReader corrupt;
+    if (!open_fixture(corrupt, "crc_corrupt.parquet")) return;
+    checksums.reset();
+    ReadRangeFunc read_corrupt = [&corrupt](size_t o, size_t n) {
+        return corrupt.read_range(o, n);
+    };
+    PagePipeline damaged(read_corrupt, *corrupt.column_chunk_meta(0, 0), pool, 4, &checksums);
+    CHECK(damaged.next(page));
+    CHECK(damaged.next(page));
+    CHECK_THROWS(damaged.next(page));
+    CHECK_EQ(checksums.failed.load(), uint64_t{1});
+
+    // Destroying a pipeline mid-chunk waits for the pages it queued, which
+    // still verify against `checksums`. On a one-thread pool, a pause
+    // queued while the second page's header is read (the third read) holds
+    // every page after the first until then
+    ParquetReader reader;
+    if (!open_fixture(reader, "snappy.parquet")) return;
+    auto busy = pool ? std::make_shared<ThreadPool>(1) : nullptr;
+    size_t reads = 0;
+    ReadRangeFunc read = [&](size_t o, size_t n) {
+        if (++reads == 3 && busy) {
+            busy->submit([] { std::this_thread::sleep_for(std::chrono::milliseconds(100)); });
+        }
+        return reader.read_range(o, n);
+    };
+    checksums.reset();
+    {
+        PagePipeline pipeline(read, *reader.column_chunk_meta(0, 0), busy, 4, &checksums);
+        CHECK(pipeline.next(page));
+    }
+    // Four queued, and with a pool the fifth queued as the first is handed over
+    CHECK_EQ(checksums.verified.load(), uint64_t{busy ? 5u : 4u});
+}
+
+} // namespace
+
+int main() {
+    check_file("snappy.parquet");
+    check_file("v2_snappy.parquet");
+    check_file("page_index.parquet");
+    check_checksums(nullptr);
+    check_checksums(std::make_shared<ThreadPool>(2));
+    return test_result();
+}
@@ -0,0 +1,98 @@
+#include "test_util.hpp"
+
+// wide.parquet: 300 rows in 3 row groups of 40-row pages, with chunk
+// statistics and a page index.
+//   c0..c7  INT32 = row * 10 + column
+//   tag     BYTE_ARRAY, dictionary encoded, "name<row % 13>", every tenth null
+
+namespace {
+
+void check_same_values(ParquetReader& projected, ParquetReader& full, const std::string& col) {
+    auto a = projected.read_column(col);
+    auto b = full.read_column(col);
+    CHECK_EQ(a.size(), size_t{300});
+    CHECK_EQ(a.size(), b.size());
+    for (size_t i = 0; i < a.size() && i < b.size(); i++) {
+        CHECK_EQ(a[i].to_string(), b[i].to_string());
+    }
+}
+
+} // namespace
+
+int main() {
+    ParquetReader full;
+    if (!open_fixture(full, "wide.parquet")) return test_result();
+
+    ParquetReader reader;
+    reader.set_projection({"c3", "tag"});
+    if (!open_fixture(reader, "wide.parquet")) return test_result();
+    const size_t c3 = static_cast<size_t>(reader.column("c3").column_index);
+    const size_t tag = static_cast<size_t>(reader.column("tag").column_index);
+
+    // Only the projected columns' pages and page index are loaded
+    size_t expected_pages = 0;
+    for (size_t id = 0; id < full.num_pages(); id++) {
+        size_t col = full.page_index_entry(id).column_idx;
+        if (col == c3 || col == tag) expected_pages++;
+    }
+    CHECK_EQ(reader.num_pages(), expected_pages);
+    for (size_t id = 0; id < reader.num_pages(); id++) {
+        size_t col = reader.page_index_entry(id).column_idx;
+        CHECK(col == c3 || col == tag);
+    }
+    for (size_t rg = 0; rg < 3; rg++) {
+        CHECK(reader.offset_index("c3", rg) != nullptr);
+        CHECK(reader.column_index("tag", rg) != nullptr);
+        CHECK(reader.offset_index("c1", rg) == nullptr);
+        CHECK(reader.column_index("c1", rg) == nullptr);
+        CHECK(full.offset_index("c1", rg) != nullptr);
+        CHECK_EQ(reader.chunk_table().num_values[reader.chunk_table().index(rg, c3)],
+                 int64_t{100});
+    }
+    CHECK_THROWS(reader.prune_pages("c1", ColumnPredicate::is_not_null()));
+    CHECK_THROWS(reader.locate_row("c1", 0));
+    CHECK_EQ(reader.prune_pages("c3", ColumnPredicate::equal(Value::from_i32(1503))).size(),
+             size_t{1});
+
+    // Unprojected columns decode their metadata on use and read the same
+    for (const auto& name : full.column_names()) check_same_values(reader, full, name);
+    ColumnVector typed = reader.read_column_vector("c5");
+    CHECK_EQ(typed.size, size_t{300});
+    if (typed.size == 300) CHECK_EQ(typed.values<int32_t>()[299], 2995);
+    ColumnStatistics stats = reader.column_statistics("c6", 2);
+    CHECK(stats.has_min_max());
+    if (stats.has_min_max()) {
+        CHECK_EQ(stats.min->to_string(), "2006");
+        CHECK_EQ(stats.max->to_string(), "2996");
+    }
+    CHECK_EQ(list(reader.prune_row_groups("c1", ColumnPredicate::greater(Value::from_i32(1500)))),
+             "{1, 2}");
+
+    // metadata() decodes every chunk; the row groups share each column's path
+    ParquetReader lazy;
+    lazy.set_projection({"c0"});
+    if (!open_fixture(lazy, "wide.parquet")) return test_result();
+    const FileMetaData& meta = lazy.metadata();
+    CHECK_EQ(meta.row_groups.size(), size_t{3});
+    for (const auto& rg : meta.row_groups) {
+        CHECK_EQ(rg.columns.size(), size_t{9});
+        for (size_t col = 0; col < rg.columns.size(); col++) {
+            const auto& chunk_meta = rg.columns[col].meta_data;
+            CHECK(chunk_meta != nullptr);
+            if (!chunk_meta) continue;
+            CHECK_EQ(chunk_meta->num_values, int64_t{100});
+            CHECK(chunk_meta->path_in_schema ==
+                  meta.row_groups[0].columns[col].meta_data->path_in_schema);
+        }
+    }
+
+    // Projecting an unknown column fails the open like any other bad input
+    ParquetReader unknown;
+    unknown.set_projection({"c1", "missing"});
+    CHECK(!unknown.open(fixture("wide.parquet")));
+    CHECK_EQ(unknown.num_columns(), size_t{0});
+    unknown.set_projection({"c1"});
+    CHECK(unknown.open(fixture("wide.parquet")));
+
+    return test_result();
+}
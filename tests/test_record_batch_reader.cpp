@@ -0,0 +1,108 @@
+#include "test_util.hpp"
+#include "reader/record_batch_reader.hpp"
+
+// RecordBatchReader against whole-column read_column_vector() results.
+// page_index.parquet (see test_page_index.cpp): s in 50-row and x in
+// 25-row pages, 4 row groups of 100 rows, so the columns' pages end at
+// different rows. snappy.parquet (see test_compression.cpp): 4 columns, 2
+// row groups of 500 rows. lists.parquet has a repeated column.
+
+namespace {
+
+// Slot `i` of a vector as text, nulls included
+std::string slot(const ColumnVector& v, size_t i) {
+    if (v.is_null(i)) return "NULL";
+    if (v.type == VectorType::BYTE_ARRAY) return std::string(v.string(i));
+    std::string out;
+    for (size_t b = 0; b < v.value_width; b++) out += std::to_string(v.fixed(i)[b]) + ".";
+    return out;
+}
+
+// The batches against the rows of `expected` in `ranges`, row by row
+void check_batches(RecordBatchReader& batches, const std::vector<std::string>& names,
+                   const std::vector<ColumnVector>& expected,
+                   const std::vector<std::pair<size_t, size_t>>& ranges) {
+    size_t total = 0;
+    for (auto [first, last] : ranges) total += last - first;
+    std::vector<size_t> rows;  // source row of each batch row
+    for (auto [first, last] : ranges) {
+        for (size_t r = first; r < last; r++) rows.push_back(r);
+    }
+
+    RecordBatch batch;
+    size_t seen = 0;
+    size_t batch_size = batches.batch_size();
+    while (batches.next(batch)) {
+        CHECK(batch.num_rows > 0);
+        // Only the last batch may be short
+        CHECK(batch.num_rows == batch_size || seen + batch.num_rows == total);
+        CHECK_EQ(batch.columns.size(), names.size());
+        CHECK(batch.names == names);
+        for (size_t c = 0; c < batch.columns.size() && c < expected.size(); c++) {
+            const ColumnVector& col = batch.column(c);
+            CHECK_EQ(col.size, batch.num_rows);
+            CHECK(batch.fields[c] != nullptr);
+            size_t nulls = 0;
+            for (size_t i = 0; i < col.size && seen + i < rows.size(); i++) {
+                nulls += col.is_null(i);
+                std::string found = slot(col, i);
+                std::string want = slot(expected[c], rows[seen + i]);
+                if (found != want) {
+                    std::cerr << names[c] << " row " << rows[seen + i] << " (batch size "
+                              << batch_size << "): " << found << " vs " << want << "\n";
+                    test_failures++;
+                    return;
+                }
+            }
+            CHECK_EQ(col.null_count, nulls);
+        }
+        seen += batch.num_rows;
+        CHECK_EQ(batches.rows_read(), static_cast<int64_t>(seen));
+    }
+    CHECK_EQ(seen, total);
+    CHECK_EQ(batch.num_rows, size_t{0});
+    CHECK(!batches.next(batch));
+}
+
+void check_file(const std::string& file, const std::vector<std::string>& names,
+                size_t rows_per_group) {
+    ParquetReader reader;
+    if (!open_fixture(reader, file)) return;
+    std::vector<ColumnVector> expected;
+    for (const auto& name : names) expected.push_back(reader.read_column_vector(name));
+    size_t rows = expected[0].size;
+
+    for (size_t batch_size : {size_t{1}, size_t{7}, size_t{25}, size_t{100}, size_t{333},
+                              size_t{4096}}) {
+        RecordBatchReader batches(reader, names, batch_size);
+        check_batches(batches, names, expected, {{0, rows}});
+        // Again from the start
+        batches.reset();
+        check_batches(batches, names, expected, {{0, rows}});
+    }
+
+    // Chosen row groups, in the order given
+    RecordBatchReader batches(reader, names, 64);
+    batches.set_row_groups({1});
+    check_batches(batches, names, expected, {{rows_per_group, 2 * rows_per_group}});
+    batches.set_row_groups({1, 0});
+    check_batches(batches, names, expected,
+                  {{rows_per_group, 2 * rows_per_group}, {0, rows_per_group}});
+    batches.set_row_groups({});
+    check_batches(batches, names, expected, {});
+}
+
+} // namespace
+
+int main() {
+    // Projection order differs from file order
+    check_file("page_index.parquet", {"x", "s"}, 100);
+    check_file("snappy.parquet", {"noise", "name", "id"}, 500);
+
+    ParquetReader reader;
+    if (open_fixture(reader, "lists.parquet")) {
+        CHECK_THROWS(RecordBatchReader(reader, {"id", "tags.list.element"}));
+        CHECK_THROWS(RecordBatchReader(reader, {"missing"}));
+    }
+    return test_result();
+}
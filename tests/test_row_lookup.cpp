@@ -0,0 +1,53 @@
+#include "test_util.hpp"
+
+// Looks up every row of fixtures with and without a page index, with
+// nulls and dictionary pages: wide.parquet (100-row row groups, 40-row
+// pages), stats.parquet and sorted_no_index.parquet (100-row row groups,
+// 25- and 20-row pages).
+
+namespace {
+
+void check_file(const std::string& name, int64_t rows_per_group) {
+    ParquetReader reader;
+    if (!open_fixture(reader, name)) return;
+    for (const auto& col : reader.column_names()) {
+        auto values = reader.read_column(col);
+        CHECK_EQ(values.size(), static_cast<size_t>(reader.num_rows()));
+        for (int64_t row = 0; row < reader.num_rows(); row++) {
+            RowLocation loc = reader.locate_row(col, row);
+            CHECK_EQ(loc.row_group_idx, static_cast<size_t>(row / rows_per_group));
+            const PageIndexEntry& page = reader.page_index_entry(loc.page_id);
+            CHECK_EQ(page.column_idx, static_cast<size_t>(reader.column(col).column_index));
+            CHECK_EQ(page.row_group_idx, loc.row_group_idx);
+            CHECK_EQ(page.first_row + loc.slot, row);
+
+            std::string expected = values[static_cast<size_t>(row)].to_string();
+            std::string found = reader.read_value(col, row).to_string();
+            if (found != expected) {
+                std::cerr << name << ": read_value(" << col << ", " << row << ") = " << found
+                          << ", expected " << expected << "\n";
+                test_failures++;
+            }
+        }
+        CHECK_THROWS(reader.locate_row(col, -1));
+        CHECK_THROWS(reader.locate_row(col, reader.num_rows()));
+        CHECK_THROWS(reader.read_value(col, reader.num_rows()));
+    }
+}
+
+} // namespace
+
+int main() {
+    check_file("wide.parquet", 100);
+    check_file("stats.parquet", 100);
+    check_file("sorted_no_index.parquet", 100);
+
+    // Lookups are limited to the projected columns
+    ParquetReader projected;
+    projected.set_projection({"c2"});
+    if (!open_fixture(projected, "wide.parquet")) return test_result();
+    CHECK_EQ(projected.read_value("c2", 123).to_string(), "1232");
+    CHECK_THROWS(projected.locate_row("c1", 0));
+
+    return test_result();
+}
@@ -0,0 +1,142 @@
+#include "test_util.hpp"
+
+// stats.parquet: 400 rows in 4 row groups, with min_value / max_value
+// chunk statistics.
+//   x  INT32 = row, null for rows 300..399 and where row % 40 == 5
+//   s  BYTE_ARRAY "k<row>", "€<row>" (0xE2 lead byte) in row group 2
+// stats_legacy.parquet: the same data with the deprecated min / max fields.
+// page_stats.parquet: x alone, 25-row pages whose headers carry statistics.
+
+namespace {
+
+using P = ColumnPredicate;
+
+void check_statistics(ParquetReader& reader) {
+    ColumnStatistics rg0 = reader.column_statistics("x", 0);
+    CHECK(rg0.has_min_max());
+    if (rg0.has_min_max()) {
+        CHECK_EQ(rg0.min->to_string(), "0");
+        CHECK_EQ(rg0.max->to_string(), "99");
+    }
+    CHECK(rg0.null_count && *rg0.null_count == 3);
+
+    // An all-null chunk has a null count but no bounds
+    ColumnStatistics rg3 = reader.column_statistics("x", 3);
+    CHECK(!rg3.has_min_max());
+    CHECK(rg3.null_count && *rg3.null_count == 100);
+}
+
+void check_pruning(ParquetReader& reader) {
+    for (int v = -1; v <= 400; v++) {
+        std::vector<size_t> expected;
+        if (v >= 0 && v < 300) expected.push_back(static_cast<size_t>(v / 100));
+        CHECK_EQ(list(reader.prune_row_groups("x", P::equal(Value::from_i32(v)))),
+                 list(expected));
+    }
+    CHECK_EQ(list(reader.prune_row_groups("x", P::less(Value::from_i32(100)))), "{0}");
+    CHECK_EQ(list(reader.prune_row_groups("x", P::less_equal(Value::from_i32(100)))), "{0, 1}");
+    CHECK_EQ(list(reader.prune_row_groups("x", P::greater(Value::from_i32(199)))), "{2}");
+    CHECK_EQ(list(reader.prune_row_groups("x", P::greater_equal(Value::from_i32(199)))),
+             "{1, 2}");
+    CHECK_EQ(list(reader.prune_row_groups("x", P::between(Value::from_i32(150),
+                                                           Value::from_i32(250)))), "{1, 2}");
+    CHECK_EQ(list(reader.prune_row_groups("x", P::between(Value::from_i32(1000),
+                                                           Value::from_i32(2000)))), "{}");
+    CHECK_EQ(list(reader.prune_row_groups("x", P::is_null())), "{0, 1, 2, 3}");
+    CHECK_EQ(list(reader.prune_row_groups("x", P::is_not_null())), "{0, 1, 2}");
+
+    // Literals of another numeric type
+    CHECK_EQ(list(reader.prune_row_groups("x", P::greater(Value::from_i64(250)))), "{2}");
+    CHECK_EQ(list(reader.prune_row_groups("x", P::less(Value::from_double(0.5)))), "{0}");
+    CHECK_EQ(list(reader.prune_row_groups("x", P::greater(Value::from_double(299.5)))), "{}");
+}
+
+// Little-endian INT32, as PLAIN statistics store it
+std::string int32_bytes(int32_t v) {
+    uint32_t bits = static_cast<uint32_t>(v);
+    std::string out;
+    for (int i = 0; i < 4; i++) out += static_cast<char>((bits >> (8 * i)) & 0xFF);
+    return out;
+}
+
+void check_page_statistics(ParquetReader& reader) {
+    for (size_t rg = 0; rg < 4; rg++) {
+        const ColumnMetaData* meta = reader.column_chunk_meta(rg, 0);
+        CHECK(meta != nullptr);
+        if (!meta) continue;
+        auto buf = reader.read_range(static_cast<size_t>(meta->data_page_offset), 256);
+
+        ThriftReader full(buf.data(), buf.size());
+        PageHeader header;
+        header.deserialize(full);
+        CHECK(header.data_page_header.has_value());
+        if (!header.data_page_header) continue;
+        const auto& stats = header.data_page_header->statistics;
+        CHECK(stats.has_value());
+        if (!stats) continue;
+        // The first page holds rows rg * 100 .. rg * 100 + 24
+        int64_t nulls = 0;
+        for (size_t row = rg * 100; row < rg * 100 + 25; row++) {
+            nulls += row >= 300 || row % 40 == 5;
+        }
+        CHECK(stats->null_count && *stats->null_count == nulls);
+        if (rg == 3) {
+            CHECK(!stats->min_value && !stats->max_value);
+        } else {
+            int32_t first = static_cast<int32_t>(rg) * 100;
+            CHECK(stats->min_value && *stats->min_value == int32_bytes(first));
+            CHECK(stats->max_value && *stats->max_value == int32_bytes(first + 24));
+        }
+
+        // The page walks skip them, ending at the same offset
+        ThriftReader fast(buf.data(), buf.size());
+        PageHeader skipped;
+        skipped.deserialize(fast, true);
+        CHECK(skipped.data_page_header && !skipped.data_page_header->statistics);
+        CHECK_EQ(fast.position(), full.position());
+        CHECK_EQ(skipped.compressed_page_size, header.compressed_page_size);
+        CHECK_EQ(skipped.data_page_header->num_values, header.data_page_header->num_values);
+    }
+
+    auto values = reader.read_column("x");
+    CHECK_EQ(values.size(), size_t{400});
+    for (size_t i = 0; i < values.size(); i++) {
+        bool null = i >= 300 || i % 40 == 5;
+        CHECK_EQ(values[i].is_null, null);
+        if (!null) CHECK_EQ(values[i].to_string(), std::to_string(i));
+    }
+}
+
+} // namespace
+
+int main() {
+    ParquetReader reader;
+    if (!open_fixture(reader, "stats.parquet")) return test_result();
+    check_statistics(reader);
+    check_pruning(reader);
+
+    // Byte arrays compare unsigned, so the 0xE2 strings sort after "k..."
+    ColumnStatistics s2 = reader.column_statistics("s", 2);
+    CHECK(s2.has_min_max());
+    if (s2.has_min_max()) CHECK_EQ(s2.min->to_string(), "€200");
+    CHECK_EQ(list(reader.prune_row_groups("s", P::greater(Value::from_string("z")))), "{2}");
+    CHECK_EQ(list(reader.prune_row_groups("s", P::equal(Value::from_string("k150")))), "{1}");
+    CHECK_EQ(list(reader.prune_row_groups("s", P::less(Value::from_string("k100")))), "{0}");
+
+    // Legacy min / max are trusted for INT32, which sorts signed...
+    ParquetReader legacy;
+    if (!open_fixture(legacy, "stats_legacy.parquet")) return test_result();
+    check_statistics(legacy);
+    check_pruning(legacy);
+
+    // ...but not for byte arrays, whose legacy order is unknown
+    for (size_t rg = 0; rg < 4; rg++) CHECK(!legacy.column_statistics("s", rg).has_min_max());
+    CHECK_EQ(list(legacy.prune_row_groups("s", P::greater(Value::from_string("z")))),
+             "{0, 1, 2, 3}");
+
+    ParquetReader page_stats;
+    if (!open_fixture(page_stats, "page_stats.parquet")) return test_result();
+    check_page_statistics(page_stats);
+
+    return test_result();
+}
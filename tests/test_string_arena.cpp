@@ -0,0 +1,122 @@
+#include "test_util.hpp"
+#include "reader/string_arena.hpp"
+#include <set>
+#include <variant>
+
+// StringArena on its own, and read_column() decoding strings into one.
+// page_index.parquet (see test_page_index.cpp) has a PLAIN string column s;
+// snappy.parquet (see test_compression.cpp) a dictionary encoded, nullable
+// one, name, in 2 row groups of 500 rows.
+
+namespace {
+
+void check_blocks() {
+    StringArena arena(16);
+    CHECK_EQ(arena.bytes_used(), size_t{0});
+    CHECK_EQ(arena.bytes_reserved(), size_t{0});
+
+    // Views stay put while later copies open new blocks
+    std::vector<std::string_view> views;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 40; i++) {
+        std::string s(static_cast<size_t>(i % 7), static_cast<char>('a' + i % 26));
+        expected.push_back(s);
+        views.push_back(arena.copy(s));
+    }
+    // One larger than a block gets a block of its own
+    std::string big(100, 'z');
+    expected.push_back(big);
+    views.push_back(arena.copy(big));
+    for (size_t i = 0; i < views.size(); i++) CHECK(views[i] == expected[i]);
+
+    size_t total = 0;
+    for (const auto& s : expected) total += s.size();
+    CHECK_EQ(arena.bytes_used(), total);
+    CHECK(arena.bytes_reserved() >= total);
+
+    // An empty copy takes no space
+    CHECK_EQ(arena.copy("", 0).size(), size_t{0});
+    CHECK_EQ(arena.bytes_used(), total);
+
+    // reset() keeps only the first block, and reuses it. views[0] is
+    // empty; views[1] opened the first block
+    const char* first = views[1].data();
+    arena.reset();
+    CHECK_EQ(arena.bytes_used(), size_t{0});
+    CHECK_EQ(arena.bytes_reserved(), size_t{16});
+    std::string_view again = arena.copy("0123456789", 10);
+    CHECK(again == "0123456789");
+    CHECK(again.data() == first);
+
+    // Moving the arena keeps the views valid
+    StringArena moved = std::move(arena);
+    CHECK(again == "0123456789");
+    CHECK(moved.copy("x", 1) == "x");
+    CHECK_EQ(moved.bytes_used(), size_t{11});
+
+    // The moved-from arena starts over in blocks of its own
+    CHECK_EQ(arena.bytes_used(), size_t{0});
+    CHECK_EQ(arena.bytes_reserved(), size_t{0});
+    std::string_view fresh = arena.copy("abcdefghij", 10);
+    CHECK(fresh == "abcdefghij");
+    CHECK(again == "0123456789");
+    CHECK_EQ(arena.bytes_reserved(), size_t{16});
+
+    // So does one moved out of by assignment
+    StringArena assigned(16);
+    assigned.copy("old", 3);
+    assigned = std::move(arena);
+    CHECK(fresh == "abcdefghij");
+    CHECK_EQ(assigned.bytes_used(), size_t{10});
+    CHECK(arena.copy("0123456789", 10) == "0123456789");
+    CHECK(fresh == "abcdefghij");
+    CHECK(again == "0123456789");
+}
+
+// A dictionary encoded column copies each row group's dictionary into the
+// arena once; its values are views of those copies
+void check_reader(const std::string& file, const std::string& column, size_t dictionary_rows) {
+    ParquetReader owned, viewed;
+    if (!open_fixture(owned, file) || !open_fixture(viewed, file)) return;
+    StringArena arena;
+    viewed.set_string_arena(&arena);
+
+    auto expected = owned.read_column(column);
+    for (int pass = 0; pass < 2; pass++) {
+        auto values = viewed.read_column(column);
+        CHECK_EQ(values.size(), expected.size());
+        size_t bytes = 0;
+        std::set<std::string_view> distinct;
+        for (size_t i = 0; i < values.size() && i < expected.size(); i++) {
+            if (dictionary_rows && i % dictionary_rows == 0) distinct.clear();
+            CHECK_EQ(values[i].is_null, expected[i].is_null);
+            if (values[i].is_null || expected[i].is_null) continue;
+            CHECK(values[i].str() == expected[i].str());
+            CHECK(std::holds_alternative<std::string_view>(values[i].data));
+            CHECK(std::holds_alternative<std::string>(expected[i].data));
+            if (!dictionary_rows || distinct.insert(values[i].str()).second) {
+                bytes += values[i].str().size();
+            }
+        }
+        // Every string, or dictionary entry, lives in the arena once
+        CHECK_EQ(arena.bytes_used(), bytes);
+        arena.reset();
+    }
+
+    // Without an arena the reader goes back to owned strings
+    viewed.set_string_arena(nullptr);
+    auto values = viewed.read_column(column);
+    CHECK_EQ(arena.bytes_used(), size_t{0});
+    for (const auto& v : values) {
+        if (!v.is_null) CHECK(std::holds_alternative<std::string>(v.data));
+    }
+}
+
+} // namespace
+
+int main() {
+    check_blocks();
+    check_reader("page_index.parquet", "s", 0);
+    check_reader("snappy.parquet", "name", 500);
+    return test_result();
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "reader/parquet_reader.hpp"
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// ── Test helpers ───────────────────────────────────────────────────────────────
+//
+// Each test is a small executable: CHECK failures are reported with their
+// location and counted, and main() returns test_result().
+
+inline int test_failures = 0;
+
+// ctest reports a test returning this as skipped
+inline constexpr int TEST_SKIPPED = 77;
+
+#define CHECK(cond)                                                                   \
+    do {                                                                              \
+        if (!(cond)) {                                                                \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #cond ") failed\n";  \
+            test_failures++;                                                          \
+        }                                                                             \
+    } while (0)
+
+#define CHECK_EQ(a, b)                                                                \
+    do {                                                                              \
+        auto&& check_a = (a);                                                         \
+        auto&& check_b = (b);                                                         \
+        if (!(check_a == check_b)) {                                                  \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK_EQ(" #a ", " #b       \
+                      << ") failed: " << check_a << " vs " << check_b << "\n";        \
+            test_failures++;                                                          \
+        }                                                                             \
+    } while (0)
+
+#define CHECK_THROWS(expr)                                                            \
+    do {                                                                              \
+        bool check_thrown = false;                                                    \
+        try {                                                                         \
+            (void)(expr);                                                             \
+        } catch (const std::exception&) {                                             \
+            check_thrown = true;                                                      \
+        }                                                                             \
+        if (!check_thrown) {                                                          \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": " #expr " did not throw\n";  \
+            test_failures++;                                                          \
+        }                                                                             \
+    } while (0)
+
+// Path of a file in tests/data
+inline std::string fixture(const std::string& name) {
+    return std::string(PARQUET_TEST_DATA) + "/" + name;
+}
+
+// Open a fixture, failing the test (and returning false) if it can't be
+inline bool open_fixture(ParquetReader& reader, const std::string& name) {
+    if (reader.open(fixture(name))) return true;
+    std::cerr << "cannot open fixture " << name << "\n";
+    test_failures++;
+    return false;
+}
+
+// "{a, b, c}", so index lists can be compared with CHECK_EQ
+inline std::string list(const std::vector<size_t>& values) {
+    std::string out = "{";
+    for (size_t i = 0; i < values.size(); i++) {
+        out += (i ? ", " : "") + std::to_string(values[i]);
+    }
+    return out + "}";
+}
+
+inline int test_result() {
+    if (test_failures > 0) std::cerr << test_failures << " check(s) failed\n";
+    return test_failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,91 @@
+#include "reader/string_arena.hpp"
+#include "test_util.hpp"
+#include "writer/parquet_writer.hpp"
+#include <chrono>
+#include <filesystem>
+
+// Round trips through ParquetWriter: strings may be owned or arena-backed
+// views, and values read back into an arena can be written out again.
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::string city(size_t i) { return "city" + std::to_string(i % 7); }
+
+void check_round_trip(const fs::path& dir) {
+    const std::string first = (dir / "first.parquet").string();
+    const std::string second = (dir / "second.parquet").string();
+    std::vector<ColumnSpec> specs = {
+        {"id", ParquetType::INT64, FieldRepetitionType::REQUIRED, {}, {}, {}},
+        {"city", ParquetType::BYTE_ARRAY, FieldRepetitionType::OPTIONAL, {}, {}, {}},
+        {"note", ParquetType::BYTE_ARRAY, FieldRepetitionType::REQUIRED, {}, {}, {}},
+    };
+
+    // city repeats (dictionary encoded), note is unique (PLAIN); every
+    // other value is an arena view
+    StringArena arena(64);
+    std::vector<Value> ids, cities, notes;
+    for (size_t i = 0; i < 500; i++) {
+        ids.push_back(Value::from_i64(static_cast<int64_t>(i)));
+        std::string c = city(i);
+        std::string n = "note " + std::to_string(i * i);
+        if (i % 9 == 4) {
+            cities.push_back(Value::null());
+        } else {
+            cities.push_back(i % 2 ? Value::from_view(arena.copy(c)) : Value::from_string(c));
+        }
+        notes.push_back(i % 2 ? Value::from_string(n) : Value::from_view(arena.copy(n)));
+    }
+    {
+        ParquetWriter writer(first, specs);
+        writer.write_row_group({ids, cities, notes});
+        writer.close();
+    }
+
+    // Read back into an arena and write that out again
+    StringArena read_arena;
+    ParquetReader reader;
+    reader.set_string_arena(&read_arena);
+    CHECK(reader.open(first));
+    std::vector<std::vector<Value>> columns;
+    for (const char* col : {"id", "city", "note"}) columns.push_back(reader.read_column(col));
+    {
+        ParquetWriter writer(second, specs);
+        writer.write_row_group(columns);
+        writer.close();
+    }
+
+    ParquetReader check;
+    CHECK(check.open(second));
+    CHECK(check.column_chunk_meta(0, 1)->dictionary_page_offset.has_value());
+    CHECK(!check.column_chunk_meta(0, 2)->dictionary_page_offset.has_value());
+    auto id = check.read_column("id");
+    auto c = check.read_column("city");
+    auto n = check.read_column("note");
+    CHECK_EQ(id.size(), size_t{500});
+    CHECK_EQ(c.size(), size_t{500});
+    CHECK_EQ(n.size(), size_t{500});
+    for (size_t i = 0; i < id.size() && i < c.size() && i < n.size(); i++) {
+        CHECK_EQ(id[i].to_string(), std::to_string(i));
+        CHECK_EQ(c[i].to_string(), i % 9 == 4 ? "NULL" : city(i));
+        CHECK_EQ(n[i].to_string(), "note " + std::to_string(i * i));
+    }
+}
+
+} // namespace
+
+int main() {
+    fs::path dir = fs::temp_directory_path() /
+                   ("parquet_writer_" + std::to_string(
+                        std::chrono::steady_clock::now().time_since_epoch().count()));
+    fs::create_directories(dir);
+    try {
+        check_round_trip(dir);
+    } catch (const std::exception& e) {
+        std::cerr << "unexpected exception: " << e.what() << "\n";
+        test_failures++;
+    }
+    fs::remove_all(dir);
+    return test_result();
+}